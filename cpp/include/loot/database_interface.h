@@ -34,6 +34,7 @@
 #include "loot/metadata/group.h"
 #include "loot/metadata/message.h"
 #include "loot/metadata/plugin_metadata.h"
+#include "loot/metadata/plugin_metadata_view.h"
 
 namespace loot {
 /** @brief The interface provided by API's database handle. */
@@ -250,6 +251,62 @@ public:
    */
   virtual void DiscardAllUserMetadata() = 0;
 
+  /**
+   *  @}
+   *  @name Additions
+   *  Functions added since v0.28.0. They are declared after all the other
+   *  functions so that the existing functions keep their positions in the
+   *  vtable.
+   *  @{
+   */
+
+  /**
+   * @brief Get a read-only view of all a plugin's loaded metadata.
+   * @details This is equivalent to `GetPluginMetadata()`, but the returned view
+   *          borrows the metadata instead of copying it into a PluginMetadata
+   *          object, so it's cheaper when the metadata only needs to be read.
+   * @param plugin
+   *        The filename of the plugin to look up metadata for.
+   * @param includeUserMetadata
+   *        If true, any user metadata the plugin has is included in the
+   *        returned metadata, otherwise the metadata returned only includes
+   *        metadata from the masterlist.
+   * @param evaluateConditions
+   *        If true, any metadata conditions are evaluated before the metadata
+   *        is returned, otherwise unevaluated metadata is returned. Evaluating
+   *        plugin metadata conditions does not clear the condition cache.
+   * @returns If the plugin has metadata, an optional containing a view of that
+   *          metadata, otherwise an optional containing no value.
+   */
+  virtual std::optional<PluginMetadataView> GetPluginMetadataView(
+      std::string_view plugin,
+      bool includeUserMetadata = true,
+      bool evaluateConditions = false) const = 0;
+
+  /**
+   * @brief Get all the loaded metadata of each of the given plugins.
+   * @details This is equivalent to calling `GetPluginMetadata()` for each
+   *          plugin, but the database is only locked once and the plugins'
+   *          metadata conditions are evaluated in parallel.
+   * @param plugins
+   *        The filenames of the plugins to look up metadata for.
+   * @param includeUserMetadata
+   *        If true, any user metadata the plugins have is included in the
+   *        returned metadata, otherwise the metadata returned only includes
+   *        metadata from the masterlist.
+   * @param evaluateConditions
+   *        If true, any metadata conditions are evaluated before the metadata
+   *        is returned, otherwise unevaluated metadata is returned. Evaluating
+   *        plugin metadata conditions does not clear the condition cache.
+   * @returns A vector of the same length as the given vector of plugin
+   *          filenames, where each element is the result of looking up
+   *          metadata for the plugin at the same index.
+   */
+  virtual std::vector<std::optional<PluginMetadata>> GetPluginMetadataBatch(
+      const std::vector<std::string_view>& plugins,
+      bool includeUserMetadata = true,
+      bool evaluateConditions = false) const = 0;
+
   /** @} */
 };
 }
@@ -127,7 +127,7 @@ public:
   /**
    * @brief Clears the plugins loaded by previous calls to `LoadPlugins()`.
    * @details This invalidates any PluginInterface pointers retrieved using
-   *          `GetPlugin()` or `GetLoadedPlugins()`.
+   *          `GetPlugin()`, `GetPlugins()` or `GetLoadedPlugins()`.
    */
   virtual void ClearLoadedPlugins() = 0;
 
@@ -237,6 +237,89 @@ public:
    *        A vector of plugin filenames sorted in the load order to set.
    */
   virtual void SetLoadOrder(const std::vector<std::string>& loadOrder) = 0;
+
+  /**
+   *  @}
+   *  @name Additions
+   *  Functions added since v0.28.0. They are declared after all the other
+   *  functions so that the existing functions keep their positions in the
+   *  vtable.
+   *  @{
+   */
+
+  /**
+   * @brief Get data for several loaded plugins at once.
+   * @details This is equivalent to calling `GetPlugin()` for each of the given
+   *          plugins, but is more efficient when getting many plugins.
+   * @param  pluginNames
+   *         The filenames of the plugins to get data for.
+   * @returns A vector of shared pointers to const PluginInterface
+   *          implementations, in the same order as the given filenames. A
+   *          pointer is null if the corresponding plugin has not been loaded.
+   *          The pointers have the same lifetime as those returned by
+   *          `GetPlugin()`.
+   */
+  virtual std::vector<std::shared_ptr<const PluginInterface>> GetPlugins(
+      const std::vector<std::string_view>& pluginNames) const = 0;
+
+  /**
+   * @brief Set whether the result of sorting plugins should be cached.
+   * @details If enabled, `SortPlugins()` returns the result of the previous
+   *          sort without sorting again if it is given the same plugins in
+   *          the same order and no plugins, metadata or load order state have
+   *          been loaded or changed since that sort. Caching is disabled by
+   *          default.
+   * @param cacheSortResults
+   *        True to cache sort results, false to stop caching them and discard
+   *        any cached result.
+   */
+  virtual void SetSortResultCaching(bool cacheSortResults) = 0;
+
+  /**
+   * @brief Set whether plugin files should be memory-mapped when they are
+   *        loaded.
+   * @details If enabled, `LoadPlugins()` memory-maps each plugin file and
+   *          parses it from the mapped memory instead of reading it into a
+   *          buffer, falling back to buffered reads for any file that can't be
+   *          memory-mapped. `LoadPluginHeaders()` and OpenMW's .omwscripts
+   *          files are not affected. This can reduce the cost of loading large
+   *          plugins, but plugin files must not be modified by another process
+   *          while they are being loaded. Memory mapping is disabled by
+   *          default.
+   * @param memoryMapPlugins
+   *        True to memory-map plugin files, false to read them into buffers.
+   */
+  virtual void SetPluginMemoryMapping(bool memoryMapPlugins) = 0;
+
+  /**
+   * @brief Set the directory in which plugin CRCs are cached between
+   *        processes.
+   * @details If a directory is set, `LoadPlugins()` reuses the cached CRCs of
+   *          plugins that have not changed since they were cached. The CRCs
+   *          of other plugins are still only calculated when they are needed,
+   *          and are only written to the cache by `SavePluginCache()`. A
+   *          plugin is treated as unchanged if its size and last modified
+   *          time are the same as when its CRC was cached. No directory is set
+   *          by default.
+   * @param cacheDirectory
+   *        The path to the cache directory, or an empty path to stop caching
+   *        plugin CRCs and discard any CRCs that have not been saved.
+   */
+  virtual void SetPluginCacheDirectory(
+      const std::filesystem::path& cacheDirectory) = 0;
+
+  /**
+   * @brief Write the CRCs that have been calculated for plugins to the plugin
+   *        cache.
+   * @details This includes the CRCs of plugins that were loaded while a cache
+   *          directory was set but have since been replaced or cleared.
+   *          Entries for plugins that no longer exist or have changed are
+   *          removed from the cache when it is written. Nothing is written if
+   *          no cache directory is set or the cache would not change.
+   */
+  virtual void SavePluginCache() = 0;
+
+  /** @} */
 };
 }
 
@@ -71,12 +71,26 @@ public:
    */
   LOOT_API Filename GetName() const;
 
+  /**
+   * Get the filename of the file without copying it.
+   * @return A reference to the file's filename. It is only valid while this
+   *         object exists and is not modified.
+   */
+  LOOT_API const Filename& GetNameRef() const;
+
   /**
    * Get the display name of the file.
    * @return The file's display name.
    */
   LOOT_API std::string GetDisplayName() const;
 
+  /**
+   * Get the display name of the file without copying it.
+   * @return A reference to the file's display name. It is only valid while this
+   *         object exists and is not modified.
+   */
+  LOOT_API const std::string& GetDisplayNameRef() const;
+
   /**
    * Get the detail message content of the file.
    *
@@ -86,18 +100,39 @@ public:
    */
   LOOT_API std::vector<MessageContent> GetDetail() const;
 
+  /**
+   * Get the detail message content of the file without copying it.
+   * @return A reference to the file's detail message content. It is only valid
+   *         while this object exists and is not modified.
+   */
+  LOOT_API const std::vector<MessageContent>& GetDetailRef() const;
+
   /**
    * Get the condition string.
    * @return The file's condition string.
    */
   LOOT_API std::string GetCondition() const;
 
+  /**
+   * Get the condition string without copying it.
+   * @return A reference to the file's condition string. It is only valid while
+   *         this object exists and is not modified.
+   */
+  LOOT_API const std::string& GetConditionRef() const;
+
   /**
    * Get the constraint that applies to the file.
    * @return The file's constraint.
    */
   LOOT_API std::string GetConstraint() const;
 
+  /**
+   * Get the constraint that applies to the file without copying it.
+   * @return A reference to the file's constraint. It is only valid while this
+   *         object exists and is not modified.
+   */
+  LOOT_API const std::string& GetConstraintRef() const;
+
 private:
   Filename name_;
   std::string display_;
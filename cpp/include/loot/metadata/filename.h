@@ -24,6 +24,7 @@
 #ifndef LOOT_METADATA_FILENAME
 #define LOOT_METADATA_FILENAME
 
+#include <functional>
 #include <string>
 #include <string_view>
 
@@ -52,10 +53,13 @@ public:
 
 private:
   std::string filename_;
+  std::string foldedFilename_;
 
   LOOT_API friend bool operator==(const Filename& lhs, const Filename& rhs);
 
   LOOT_API friend bool operator<(const Filename& lhs, const Filename& rhs);
+
+  friend struct std::hash<Filename>;
 };
 
 /**
@@ -104,4 +108,16 @@ LOOT_API bool operator<=(const Filename& lhs, const Filename& rhs);
 LOOT_API bool operator>=(const Filename& lhs, const Filename& rhs);
 }
 
+namespace std {
+/**
+ * A hash function for Filename objects that is consistent with their
+ * case-insensitive equality, so that Filename objects can be stored in
+ * unordered containers.
+ */
+template<>
+struct hash<loot::Filename> {
+  LOOT_API size_t operator()(const loot::Filename& filename) const noexcept;
+};
+}
+
 #endif
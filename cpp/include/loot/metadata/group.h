@@ -67,18 +67,39 @@ public:
    */
   LOOT_API std::string GetName() const;
 
+  /**
+   * Get the name of the group without copying it.
+   * @return A reference to the group's name. It is only valid while this object
+   *         exists and is not modified.
+   */
+  LOOT_API const std::string& GetNameRef() const;
+
   /**
    * Get the description of the group.
    * @return The group's description.
    */
   LOOT_API std::string GetDescription() const;
 
+  /**
+   * Get the description of the group without copying it.
+   * @return A reference to the group's description. It is only valid while this
+   *         object exists and is not modified.
+   */
+  LOOT_API const std::string& GetDescriptionRef() const;
+
   /**
    * Get the set of groups this group loads after.
    * @return A set of group names.
    */
   LOOT_API std::vector<std::string> GetAfterGroups() const;
 
+  /**
+   * Get the set of groups this group loads after without copying it.
+   * @return A reference to the names of the groups this group loads after. It
+   *         is only valid while this object exists and is not modified.
+   */
+  LOOT_API const std::vector<std::string>& GetAfterGroupsRef() const;
+
 private:
   std::string name_{DEFAULT_NAME};
   std::string description_;
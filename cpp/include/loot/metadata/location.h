@@ -57,12 +57,26 @@ public:
    */
   LOOT_API std::string GetURL() const;
 
+  /**
+   * Get the object's URL without copying it.
+   * @return A reference to the URL string. It is only valid while this object
+   *         exists and is not modified.
+   */
+  LOOT_API const std::string& GetURLRef() const;
+
   /**
    * Get the object's name.
    * @return The name of the location.
    */
   LOOT_API std::string GetName() const;
 
+  /**
+   * Get the object's name without copying it.
+   * @return A reference to the name of the location. It is only valid while
+   *         this object exists and is not modified.
+   */
+  LOOT_API const std::string& GetNameRef() const;
+
 private:
   std::string url_;
   std::string name_;
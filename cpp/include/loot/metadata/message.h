@@ -84,12 +84,26 @@ public:
    */
   LOOT_API std::vector<MessageContent> GetContent() const;
 
+  /**
+   * Get the message content without copying it.
+   * @return A reference to the message's MessageContent objects. It is only
+   *         valid while this object exists and is not modified.
+   */
+  LOOT_API const std::vector<MessageContent>& GetContentRef() const;
+
   /**
    * Get the condition string.
    * @return The message's condition string.
    */
   LOOT_API std::string GetCondition() const;
 
+  /**
+   * Get the condition string without copying it.
+   * @return A reference to the message's condition string. It is only valid
+   *         while this object exists and is not modified.
+   */
+  LOOT_API const std::string& GetConditionRef() const;
+
 private:
   MessageType type_{MessageType::say};
   std::vector<MessageContent> content_;
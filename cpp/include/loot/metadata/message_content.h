@@ -65,12 +65,26 @@ public:
    */
   LOOT_API std::string GetText() const;
 
+  /**
+   * Get the message text without copying it.
+   * @return A reference to the message text. It is only valid while this object
+   *         exists and is not modified.
+   */
+  LOOT_API const std::string& GetTextRef() const;
+
   /**
    * Get the message language.
    * @return A code representing the language that the message is written in.
    */
   LOOT_API std::string GetLanguage() const;
 
+  /**
+   * Get the message language without copying it.
+   * @return A reference to the code of the language that the message is written
+   *         in. It is only valid while this object exists and is not modified.
+   */
+  LOOT_API const std::string& GetLanguageRef() const;
+
 private:
   std::string text_;
   std::string language_{DEFAULT_LANGUAGE};
@@ -114,6 +114,14 @@ public:
    */
   LOOT_API std::string GetCleaningUtility() const;
 
+  /**
+   * Get the name of the cleaning utility that was used to check the plugin
+   * without copying it.
+   * @return A reference to the cleaning utility name. It is only valid while
+   *         this object exists and is not modified.
+   */
+  LOOT_API const std::string& GetCleaningUtilityRef() const;
+
   /**
    * Get any additional informative message content supplied with the cleaning
    * data, eg. a link to a cleaning guide or information on wild edits or manual
@@ -122,6 +130,14 @@ public:
    */
   LOOT_API std::vector<MessageContent> GetDetail() const;
 
+  /**
+   * Get any additional informative message content supplied with the cleaning
+   * data without copying it.
+   * @return A reference to the localised MessageContent objects. It is only
+   *         valid while this object exists and is not modified.
+   */
+  LOOT_API const std::vector<MessageContent>& GetDetailRef() const;
+
 private:
   uint32_t crc_{0};
   unsigned int itm_{0};
@@ -76,6 +76,13 @@ public:
    */
   LOOT_API std::string GetName() const;
 
+  /**
+   * Get the plugin name without copying it.
+   * @return A reference to the plugin name. It is only valid while this object
+   *         exists and is not modified.
+   */
+  LOOT_API const std::string& GetNameRef() const;
+
   /**
    * Get the plugin's group.
    * @return An optional containing the name of the group this plugin belongs to
@@ -84,54 +91,119 @@ public:
    */
   LOOT_API std::optional<std::string> GetGroup() const;
 
+  /**
+   * Get the plugin's group without copying it.
+   * @return A reference to the optional group name. It is only valid while this
+   *         object exists and is not modified.
+   */
+  LOOT_API const std::optional<std::string>& GetGroupRef() const;
+
   /**
    * Get the plugins that the plugin must load after.
    * @return The plugins that the plugin must load after.
    */
   LOOT_API std::vector<File> GetLoadAfterFiles() const;
 
+  /**
+   * Get the plugins that the plugin must load after without copying it.
+   * @return A reference to the plugins that the plugin must load after. It is
+   *         only valid while this object exists and is not modified.
+   */
+  LOOT_API const std::vector<File>& GetLoadAfterFilesRef() const;
+
   /**
    * Get the files that the plugin requires to be installed.
    * @return The files that the plugin requires to be installed.
    */
   LOOT_API std::vector<File> GetRequirements() const;
 
+  /**
+   * Get the files that the plugin requires to be installed without copying it.
+   * @return A reference to the files that the plugin requires to be installed.
+   *         It is only valid while this object exists and is not modified.
+   */
+  LOOT_API const std::vector<File>& GetRequirementsRef() const;
+
   /**
    * Get the files that the plugin is incompatible with.
    * @return The files that the plugin is incompatible with.
    */
   LOOT_API std::vector<File> GetIncompatibilities() const;
 
+  /**
+   * Get the files that the plugin is incompatible with without copying it.
+   * @return A reference to the files that the plugin is incompatible with. It
+   *         is only valid while this object exists and is not modified.
+   */
+  LOOT_API const std::vector<File>& GetIncompatibilitiesRef() const;
+
   /**
    * Get the plugin's messages.
    * @return The plugin's messages.
    */
   LOOT_API std::vector<Message> GetMessages() const;
 
+  /**
+   * Get the plugin's messages without copying it.
+   * @return A reference to the plugin's messages. It is only valid while this
+   *         object exists and is not modified.
+   */
+  LOOT_API const std::vector<Message>& GetMessagesRef() const;
+
   /**
    * Get the plugin's Bash Tag suggestions.
    * @return The plugin's Bash Tag suggestions.
    */
   LOOT_API std::vector<Tag> GetTags() const;
 
+  /**
+   * Get the plugin's Bash Tag suggestions without copying it.
+   * @return A reference to the plugin's Bash Tag suggestions. It is only valid
+   *         while this object exists and is not modified.
+   */
+  LOOT_API const std::vector<Tag>& GetTagsRef() const;
+
   /**
    * Get the plugin's dirty plugin information.
    * @return The PluginCleaningData objects that identify the plugin as dirty.
    */
   LOOT_API std::vector<PluginCleaningData> GetDirtyInfo() const;
 
+  /**
+   * Get the plugin's dirty plugin information without copying it.
+   * @return A reference to the PluginCleaningData objects that identify the
+   *         plugin as dirty. It is only valid while this object exists and is
+   *         not modified.
+   */
+  LOOT_API const std::vector<PluginCleaningData>& GetDirtyInfoRef() const;
+
   /**
    * Get the plugin's clean plugin information.
    * @return The PluginCleaningData objects that identify the plugin as clean.
    */
   LOOT_API std::vector<PluginCleaningData> GetCleanInfo() const;
 
+  /**
+   * Get the plugin's clean plugin information without copying it.
+   * @return A reference to the PluginCleaningData objects that identify the
+   *         plugin as clean. It is only valid while this object exists and is
+   *         not modified.
+   */
+  LOOT_API const std::vector<PluginCleaningData>& GetCleanInfoRef() const;
+
   /**
    * Get the locations at which this plugin can be found.
    * @return The locations at which this plugin can be found.
    */
   LOOT_API std::vector<Location> GetLocations() const;
 
+  /**
+   * Get the locations at which this plugin can be found without copying it.
+   * @return A reference to the locations at which this plugin can be found. It
+   *         is only valid while this object exists and is not modified.
+   */
+  LOOT_API const std::vector<Location>& GetLocationsRef() const;
+
   /**
    * Set the plugin's group.
    * @param group
@@ -151,6 +223,14 @@ public:
    */
   LOOT_API void SetLoadAfterFiles(const std::vector<File>& after);
 
+  /**
+   * Set the files that the plugin must load after, moving them into this
+   * object.
+   * @param after
+   *        The files to move from.
+   */
+  LOOT_API void SetLoadAfterFiles(std::vector<File>&& after);
+
   /**
    * Set the files that the plugin requires to be installed.
    * @param requirements
@@ -158,6 +238,14 @@ public:
    */
   LOOT_API void SetRequirements(const std::vector<File>& requirements);
 
+  /**
+   * Set the files that the plugin requires to be installed,
+   * moving them into this object.
+   * @param requirements
+   *        The files to move from.
+   */
+  LOOT_API void SetRequirements(std::vector<File>&& requirements);
+
   /**
    * Set the files that the plugin must load after.
    * @param incompatibilities
@@ -166,6 +254,14 @@ public:
   LOOT_API void SetIncompatibilities(
       const std::vector<File>& incompatibilities);
 
+  /**
+   * Set the files that the plugin is incompatible with, moving them into this
+   * object.
+   * @param incompatibilities
+   *        The files to move from.
+   */
+  LOOT_API void SetIncompatibilities(std::vector<File>&& incompatibilities);
+
   /**
    * Set the plugin's messages.
    * @param messages
@@ -173,6 +269,13 @@ public:
    */
   LOOT_API void SetMessages(const std::vector<Message>& messages);
 
+  /**
+   * Set the plugin's messages by moving them into this object.
+   * @param messages
+   *        The messages to move from.
+   */
+  LOOT_API void SetMessages(std::vector<Message>&& messages);
+
   /**
    * Set the plugin's Bash Tag suggestions.
    * @param tags
@@ -180,6 +283,13 @@ public:
    */
   LOOT_API void SetTags(const std::vector<Tag>& tags);
 
+  /**
+   * Set the plugin's Bash Tag suggestions by moving them into this object.
+   * @param tags
+   *        The Bash Tag suggestions to move from.
+   */
+  LOOT_API void SetTags(std::vector<Tag>&& tags);
+
   /**
    * Set the plugin's dirty information.
    * @param info
@@ -187,6 +297,13 @@ public:
    */
   LOOT_API void SetDirtyInfo(const std::vector<PluginCleaningData>& info);
 
+  /**
+   * Set the plugin's dirty information by moving it into this object.
+   * @param info
+   *        The dirty information to move from.
+   */
+  LOOT_API void SetDirtyInfo(std::vector<PluginCleaningData>&& info);
+
   /**
    * Set the plugin's clean information.
    * @param info
@@ -194,6 +311,13 @@ public:
    */
   LOOT_API void SetCleanInfo(const std::vector<PluginCleaningData>& info);
 
+  /**
+   * Set the plugin's clean information by moving it into this object.
+   * @param info
+   *        The clean information to move from.
+   */
+  LOOT_API void SetCleanInfo(std::vector<PluginCleaningData>&& info);
+
   /**
    * Set the plugin's locations.
    * @param locations
@@ -201,6 +325,13 @@ public:
    */
   LOOT_API void SetLocations(const std::vector<Location>& locations);
 
+  /**
+   * Set the plugin's locations by moving them into this object.
+   * @param locations
+   *        The locations to move from.
+   */
+  LOOT_API void SetLocations(std::vector<Location>&& locations);
+
   /**
    * Check if no plugin metadata is set.
    * @return True if the group is implicit and the metadata containers are all
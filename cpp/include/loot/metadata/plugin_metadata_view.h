@@ -0,0 +1,455 @@
+/*  LOOT
+
+    A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+    Fallout: New Vegas.
+
+    Copyright (C) 2025    WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+#ifndef LOOT_METADATA_PLUGIN_METADATA_VIEW
+#define LOOT_METADATA_PLUGIN_METADATA_VIEW
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "loot/api_decorator.h"
+#include "loot/enum/message_type.h"
+
+namespace loot {
+// Used internally by libloot to create views of its data.
+class MetadataViewAccess;
+
+/**
+ * A read-only sequence of metadata views.
+ *
+ * The views are created on demand when elements are accessed. The list shares
+ * ownership of the data of the PluginMetadataView that it was obtained from,
+ * so it remains valid even if that view is destroyed.
+ */
+template<typename T>
+class MetadataViewList {
+public:
+  /**
+   * An iterator over the views in a MetadataViewList. An iterator is only
+   * valid while the list that it was obtained from exists.
+   */
+  class Iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = T;
+
+    Iterator() = default;
+
+    T operator*() const { return (*list_)[index_]; }
+
+    Iterator& operator++() {
+      ++index_;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto copy = *this;
+      ++index_;
+      return copy;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return list_ == other.list_ && index_ == other.index_;
+    }
+
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+  private:
+    friend class MetadataViewList;
+
+    Iterator(const MetadataViewList* list, size_t index) :
+        list_(list), index_(index) {}
+
+    const MetadataViewList* list_{nullptr};
+    size_t index_{0};
+  };
+
+  /**
+   * Construct an empty list.
+   */
+  MetadataViewList() = default;
+
+  /**
+   * Get the number of elements in the list.
+   */
+  size_t size() const { return size_; }
+
+  /**
+   * Check if the list has no elements.
+   */
+  bool empty() const { return size_ == 0; }
+
+  /**
+   * Get a view of the element at the given index, which must be less than the
+   * size of the list.
+   */
+  T operator[](size_t index) const { return accessor_(data_, size_, index); }
+
+  /**
+   * Get an iterator to the first element.
+   */
+  Iterator begin() const { return Iterator(this, 0); }
+
+  /**
+   * Get an iterator past the last element.
+   */
+  Iterator end() const { return Iterator(this, size_); }
+
+private:
+  friend class MetadataViewAccess;
+
+  using Accessor = T (*)(const std::shared_ptr<const void>& data,
+                         size_t size,
+                         size_t index);
+
+  MetadataViewList(std::shared_ptr<const void> data,
+                   size_t size,
+                   Accessor accessor) :
+      data_(std::move(data)), size_(size), accessor_(accessor) {}
+
+  std::shared_ptr<const void> data_;
+  size_t size_{0};
+  Accessor accessor_{nullptr};
+};
+
+/**
+ * A read-only view of a MessageContent object's data.
+ */
+class MessageContentView {
+public:
+  /**
+   * Get the message content text.
+   * @return A string containing the message content text.
+   */
+  LOOT_API std::string_view GetText() const;
+
+  /**
+   * Get the message content's language code.
+   * @return The message content's language code.
+   */
+  LOOT_API std::string_view GetLanguage() const;
+
+private:
+  friend class MetadataViewAccess;
+
+  explicit MessageContentView(std::shared_ptr<const void> content) :
+      content_(std::move(content)) {}
+
+  std::shared_ptr<const void> content_;
+};
+
+/**
+ * A read-only view of a File object's data.
+ */
+class FileView {
+public:
+  /**
+   * Get the filename of the file.
+   * @return The file's filename.
+   */
+  LOOT_API std::string_view GetName() const;
+
+  /**
+   * Get the display name of the file.
+   * @return The file's display name.
+   */
+  LOOT_API std::string_view GetDisplayName() const;
+
+  /**
+   * Get the detail message content of the file.
+   * @return The file's detail message content.
+   */
+  LOOT_API MetadataViewList<MessageContentView> GetDetail() const;
+
+  /**
+   * Get the condition string.
+   * @return The file's condition string.
+   */
+  LOOT_API std::string_view GetCondition() const;
+
+  /**
+   * Get the constraint string.
+   * @return The file's constraint string.
+   */
+  LOOT_API std::string_view GetConstraint() const;
+
+private:
+  friend class MetadataViewAccess;
+
+  explicit FileView(std::shared_ptr<const void> file) :
+      file_(std::move(file)) {}
+
+  std::shared_ptr<const void> file_;
+};
+
+/**
+ * A read-only view of a Location object's data.
+ */
+class LocationView {
+public:
+  /**
+   * Get the object's URL.
+   * @return A URL string.
+   */
+  LOOT_API std::string_view GetURL() const;
+
+  /**
+   * Get the object's name.
+   * @return The name of the location.
+   */
+  LOOT_API std::string_view GetName() const;
+
+private:
+  friend class MetadataViewAccess;
+
+  explicit LocationView(std::shared_ptr<const void> location) :
+      location_(std::move(location)) {}
+
+  std::shared_ptr<const void> location_;
+};
+
+/**
+ * A read-only view of a Message object's data.
+ */
+class MessageView {
+public:
+  /**
+   * Get the message type.
+   * @return The message type.
+   */
+  LOOT_API MessageType GetType() const;
+
+  /**
+   * Get the message content.
+   * @return Views of the message's MessageContent objects.
+   */
+  LOOT_API MetadataViewList<MessageContentView> GetContent() const;
+
+  /**
+   * Get the condition string.
+   * @return The message's condition string.
+   */
+  LOOT_API std::string_view GetCondition() const;
+
+private:
+  friend class MetadataViewAccess;
+
+  explicit MessageView(std::shared_ptr<const void> message) :
+      message_(std::move(message)) {}
+
+  std::shared_ptr<const void> message_;
+};
+
+/**
+ * A read-only view of a PluginCleaningData object's data.
+ */
+class PluginCleaningDataView {
+public:
+  /**
+   * Get the CRC that identifies the plugin that the cleaning data is for.
+   * @return A CRC-32 checksum.
+   */
+  LOOT_API uint32_t GetCRC() const;
+
+  /**
+   * Get the number of Identical To Master records in the plugin.
+   * @return The number of Identical To Master records in the plugin.
+   */
+  LOOT_API unsigned int GetITMCount() const;
+
+  /**
+   * Get the number of deleted references in the plugin.
+   * @return The number of deleted references in the plugin.
+   */
+  LOOT_API unsigned int GetDeletedReferenceCount() const;
+
+  /**
+   * Get the number of deleted navmeshes in the plugin.
+   * @return The number of deleted navmeshes in the plugin.
+   */
+  LOOT_API unsigned int GetDeletedNavmeshCount() const;
+
+  /**
+   * Get the name of the cleaning utility that was used to check the plugin.
+   * @return A cleaning utility name, possibly related information such as
+   *         a version number and/or a CommonMark-formatted URL to the
+   *         utility's download location.
+   */
+  LOOT_API std::string_view GetCleaningUtility() const;
+
+  /**
+   * Get any additional informative message content supplied with the cleaning
+   * data.
+   * @return Views of the detail message content.
+   */
+  LOOT_API MetadataViewList<MessageContentView> GetDetail() const;
+
+private:
+  friend class MetadataViewAccess;
+
+  explicit PluginCleaningDataView(std::shared_ptr<const void> data) :
+      data_(std::move(data)) {}
+
+  std::shared_ptr<const void> data_;
+};
+
+/**
+ * A read-only view of a Tag object's data.
+ */
+class TagView {
+public:
+  /**
+   * Check if the tag should be added.
+   * @return True if the tag should be added, false if it should be removed.
+   */
+  LOOT_API bool IsAddition() const;
+
+  /**
+   * Get the tag's name.
+   * @return The tag's name.
+   */
+  LOOT_API std::string_view GetName() const;
+
+  /**
+   * Get the condition string.
+   * @return The tag's condition string.
+   */
+  LOOT_API std::string_view GetCondition() const;
+
+private:
+  friend class MetadataViewAccess;
+
+  explicit TagView(std::shared_ptr<const void> tag) : tag_(std::move(tag)) {}
+
+  std::shared_ptr<const void> tag_;
+};
+
+/**
+ * A read-only view of a plugin's metadata that borrows libloot's internal
+ * copy of the data instead of copying it into a PluginMetadata object.
+ *
+ * Getting a view and reading from it does not allocate any strings or
+ * containers, so it is cheaper than getting a PluginMetadata object when the
+ * metadata only needs to be read.
+ *
+ * The views obtained from a PluginMetadataView share ownership of its data,
+ * and the strings obtained from any of those views are valid while the
+ * PluginMetadataView or any view obtained from it exists.
+ */
+class PluginMetadataView {
+public:
+  /**
+   * Get the plugin name.
+   * @return The plugin name.
+   */
+  LOOT_API std::string_view GetName() const;
+
+  /**
+   * Get the plugin's group.
+   * @return An optional containing the name of the group this plugin belongs to
+   *         if it was explicitly set, otherwise an optional containing no
+   *         value.
+   */
+  LOOT_API std::optional<std::string_view> GetGroup() const;
+
+  /**
+   * Get the plugins that the plugin must load after.
+   * @return Views of the plugins that the plugin must load after.
+   */
+  LOOT_API MetadataViewList<FileView> GetLoadAfterFiles() const;
+
+  /**
+   * Get the files that the plugin requires to be installed.
+   * @return Views of the files that the plugin requires to be installed.
+   */
+  LOOT_API MetadataViewList<FileView> GetRequirements() const;
+
+  /**
+   * Get the files that the plugin is incompatible with.
+   * @return Views of the files that the plugin is incompatible with.
+   */
+  LOOT_API MetadataViewList<FileView> GetIncompatibilities() const;
+
+  /**
+   * Get the plugin's messages.
+   * @return Views of the plugin's messages.
+   */
+  LOOT_API MetadataViewList<MessageView> GetMessages() const;
+
+  /**
+   * Get the plugin's Bash Tag suggestions.
+   * @return Views of the plugin's Bash Tag suggestions.
+   */
+  LOOT_API MetadataViewList<TagView> GetTags() const;
+
+  /**
+   * Get the plugin's dirty plugin information.
+   * @return Views of the cleaning data that identify the plugin as dirty.
+   */
+  LOOT_API MetadataViewList<PluginCleaningDataView> GetDirtyInfo() const;
+
+  /**
+   * Get the plugin's clean plugin information.
+   * @return Views of the cleaning data that identify the plugin as clean.
+   */
+  LOOT_API MetadataViewList<PluginCleaningDataView> GetCleanInfo() const;
+
+  /**
+   * Get the locations at which this plugin can be found.
+   * @return Views of the locations at which this plugin can be found.
+   */
+  LOOT_API MetadataViewList<LocationView> GetLocations() const;
+
+  /**
+   * Check if no plugin metadata is set.
+   * @return True if the group is implicit and the metadata containers are all
+   *         empty, false otherwise.
+   */
+  LOOT_API bool HasNameOnly() const;
+
+  /**
+   * Check if the plugin name is a regular expression.
+   * @return True if the plugin name contains any of the characters `:\*?|`,
+   *         false otherwise.
+   */
+  LOOT_API bool IsRegexPlugin() const;
+
+private:
+  friend class MetadataViewAccess;
+
+  explicit PluginMetadataView(std::shared_ptr<const void> metadata) :
+      metadata_(std::move(metadata)) {}
+
+  std::shared_ptr<const void> metadata_;
+};
+}
+
+#endif
@@ -67,12 +67,26 @@ public:
    */
   LOOT_API std::string GetName() const;
 
+  /**
+   * Get the tag's name without copying it.
+   * @return A reference to the tag's name. It is only valid while this object
+   *         exists and is not modified.
+   */
+  LOOT_API const std::string& GetNameRef() const;
+
   /**
    * Get the condition string.
    * @return The tag's condition string.
    */
   LOOT_API std::string GetCondition() const;
 
+  /**
+   * Get the condition string without copying it.
+   * @return A reference to the tag's condition string. It is only valid while
+   *         this object exists and is not modified.
+   */
+  LOOT_API const std::string& GetConditionRef() const;
+
 private:
   std::string name_;
   bool addTag_{true};
@@ -84,8 +84,14 @@ public:
 
   /**
    * Get the plugin's CRC-32 checksum.
+   *
+   * The checksum may be calculated from the plugin file the first time that
+   * it is needed, after the plugin has been loaded. If the file's size or
+   * modification time has changed since the plugin was loaded, or the file
+   * could not be read, the checksum is not calculated.
    * @return An optional containing the plugin's CRC-32 checksum if the plugin
-   *         has been fully loaded, otherwise an optional containing no value.
+   *         has been fully loaded and its checksum could be calculated,
+   *         otherwise an optional containing no value.
    */
   virtual std::optional<uint32_t> GetCRC() const = 0;
 
@@ -173,6 +179,39 @@ public:
    *         data compared.
    */
   virtual bool DoRecordsOverlap(const PluginInterface& plugin) const = 0;
+
+  // The functions below were added since v0.28.0, and are declared after all
+  // the other functions so that the existing functions keep their positions in
+  // the vtable.
+
+  /**
+   * Get the plugin's filename without copying it.
+   * @return A reference to the value returned by GetName(). It remains valid
+   *         for the lifetime of this object.
+   */
+  virtual const std::string& GetNameRef() const = 0;
+
+  /**
+   * Get the plugin's version number without copying it.
+   * @return A reference to the value returned by GetVersion(). It remains
+   *         valid for the lifetime of this object.
+   */
+  virtual const std::optional<std::string>& GetVersionRef() const = 0;
+
+  /**
+   * Get the plugin's masters without copying them.
+   * @return A reference to the value returned by GetMasters(). It remains
+   *         valid for the lifetime of this object.
+   */
+  virtual const std::vector<std::string>& GetMastersRef() const = 0;
+
+  /**
+   * Get any Bash Tags found in the plugin's description field without copying
+   * them.
+   * @return A reference to the value returned by GetBashTags(). It remains
+   *         valid for the lifetime of this object.
+   */
+  virtual const std::vector<std::string>& GetBashTagsRef() const = 0;
 };
 }
 
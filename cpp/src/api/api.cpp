@@ -23,8 +23,9 @@ extern const uint8_t LIBLOOT_LOG_LEVEL_WARNING;
 
 extern const uint8_t LIBLOOT_LOG_LEVEL_ERROR;
 
-void libloot_set_logging_callback(void (*callback)(uint8_t, const char*, void*),
-                                  void* context);
+void libloot_set_logging_callback(
+    void (*callback)(uint8_t, const char*, size_t, void*),
+    void* context);
 }
 
 namespace {
@@ -65,10 +66,13 @@ loot::rust::LogLevel convert(LogLevel level) {
   }
 }
 
-void loggingCallback(uint8_t level, const char* message, void* context) noexcept {
+void loggingCallback(uint8_t level,
+                     const char* message,
+                     size_t length,
+                     void* context) noexcept {
   try {
     auto& callback = *static_cast<Callback*>(context);
-    callback(convert(level), message);
+    callback(convert(level), std::string_view(message, length));
   } catch (...) {
     // Can't do anything with the exception.
   }
@@ -154,18 +154,19 @@ loot::Vertex convert(const loot::rust::Vertex& vertex) {
 }
 
 ::rust::Box<loot::rust::Group> convert(const loot::Group& group) {
-  return loot::rust::new_group(
-      group.GetName(), group.GetDescription(), convert(group.GetAfterGroups()));
+  return loot::rust::new_group(group.GetNameRef(),
+                               group.GetDescriptionRef(),
+                               convert(group.GetAfterGroupsRef()));
 }
 
 ::rust::Box<loot::rust::File> convert(const loot::File& file) {
   try {
     return loot::rust::new_file(
-        std::string(file.GetName()),
-        file.GetDisplayName(),
-        file.GetCondition(),
-        ::rust::Slice(convert<loot::rust::MessageContent>(file.GetDetail())),
-        file.GetConstraint());
+        std::string(file.GetNameRef()),
+        file.GetDisplayNameRef(),
+        file.GetConditionRef(),
+        ::rust::Slice(convert<loot::rust::MessageContent>(file.GetDetailRef())),
+        file.GetConstraintRef());
   } catch (const ::rust::Error& e) {
     std::rethrow_exception(mapError(e));
   }
@@ -186,8 +187,8 @@ loot::rust::MessageType convert(loot::MessageType messageType) {
 
 ::rust::Box<loot::rust::MessageContent> convert(
     const loot::MessageContent& content) {
-  return loot::rust::new_message_content(content.GetText(),
-                                         content.GetLanguage());
+  return loot::rust::new_message_content(content.GetTextRef(),
+                                         content.GetLanguageRef());
 }
 
 ::rust::Box<loot::rust::Message> convert(const loot::Message& message) {
@@ -195,8 +196,8 @@ loot::rust::MessageType convert(loot::MessageType messageType) {
     return loot::rust::multilingual_message(
         convert(message.GetType()),
         ::rust::Slice(
-            convert<loot::rust::MessageContent>(message.GetContent())),
-        message.GetCondition());
+            convert<loot::rust::MessageContent>(message.GetContentRef())),
+        message.GetConditionRef());
   } catch (const ::rust::Error& e) {
     std::rethrow_exception(mapError(e));
   }
@@ -207,7 +208,8 @@ loot::rust::MessageType convert(loot::MessageType messageType) {
     const auto suggestion = tag.IsAddition()
                                 ? loot::rust::TagSuggestion::Addition
                                 : loot::rust::TagSuggestion::Removal;
-    return loot::rust::new_tag(tag.GetName(), suggestion, tag.GetCondition());
+    return loot::rust::new_tag(
+        tag.GetNameRef(), suggestion, tag.GetConditionRef());
   } catch (const ::rust::Error& e) {
     std::rethrow_exception(mapError(e));
   }
@@ -218,8 +220,8 @@ loot::rust::MessageType convert(loot::MessageType messageType) {
   try {
     return loot::rust::new_plugin_cleaning_data(
         data.GetCRC(),
-        data.GetCleaningUtility(),
-        ::rust::Slice(convert<loot::rust::MessageContent>(data.GetDetail())),
+        data.GetCleaningUtilityRef(),
+        ::rust::Slice(convert<loot::rust::MessageContent>(data.GetDetailRef())),
         data.GetITMCount(),
         data.GetDeletedReferenceCount(),
         data.GetDeletedNavmeshCount());
@@ -229,34 +231,35 @@ loot::rust::MessageType convert(loot::MessageType messageType) {
 }
 
 ::rust::Box<loot::rust::Location> convert(const loot::Location& location) {
-  return loot::rust::new_location(location.GetURL(), location.GetName());
+  return loot::rust::new_location(location.GetURLRef(), location.GetNameRef());
 }
 
 ::rust::Box<loot::rust::PluginMetadata> convert(
     const loot::PluginMetadata& metadata) {
   try {
-    auto output = loot::rust::new_plugin_metadata(metadata.GetName());
+    auto output = loot::rust::new_plugin_metadata(metadata.GetNameRef());
 
-    if (metadata.GetGroup().has_value()) {
-      output->set_group(metadata.GetGroup().value());
+    const auto& group = metadata.GetGroupRef();
+    if (group.has_value()) {
+      output->set_group(group.value());
     }
 
-    output->set_load_after_files(
-        ::rust::Slice(convert<loot::rust::File>(metadata.GetLoadAfterFiles())));
-    output->set_requirements(
-        ::rust::Slice(convert<loot::rust::File>(metadata.GetRequirements())));
+    output->set_load_after_files(::rust::Slice(
+        convert<loot::rust::File>(metadata.GetLoadAfterFilesRef())));
+    output->set_requirements(::rust::Slice(
+        convert<loot::rust::File>(metadata.GetRequirementsRef())));
     output->set_incompatibilities(::rust::Slice(
-        convert<loot::rust::File>(metadata.GetIncompatibilities())));
-    output->set_messages(
-        ::rust::Slice(convert<loot::rust::Message>(metadata.GetMessages())));
+        convert<loot::rust::File>(metadata.GetIncompatibilitiesRef())));
+    output->set_messages(::rust::Slice(
+        convert<loot::rust::Message>(metadata.GetMessagesRef())));
     output->set_tags(
-        ::rust::Slice(convert<loot::rust::Tag>(metadata.GetTags())));
+        ::rust::Slice(convert<loot::rust::Tag>(metadata.GetTagsRef())));
     output->set_dirty_info(::rust::Slice(
-        convert<loot::rust::PluginCleaningData>(metadata.GetDirtyInfo())));
+        convert<loot::rust::PluginCleaningData>(metadata.GetDirtyInfoRef())));
     output->set_clean_info(::rust::Slice(
-        convert<loot::rust::PluginCleaningData>(metadata.GetCleanInfo())));
-    output->set_locations(
-        ::rust::Slice(convert<loot::rust::Location>(metadata.GetLocations())));
+        convert<loot::rust::PluginCleaningData>(metadata.GetCleanInfoRef())));
+    output->set_locations(::rust::Slice(
+        convert<loot::rust::Location>(metadata.GetLocationsRef())));
 
     return output;
   } catch (const ::rust::Error& e) {
@@ -269,6 +272,7 @@ loot::rust::MessageType convert(loot::MessageType messageType) {
 
 ::rust::Vec<::rust::String> convert(const std::vector<std::string>& vector) {
   ::rust::Vec<::rust::String> strings;
+  strings.reserve(vector.size());
   for (const auto& str : vector) {
     strings.push_back(str);
   }
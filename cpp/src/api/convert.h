@@ -70,6 +70,7 @@ loot::rust::MessageType convert(loot::MessageType messageType);
 template<typename T, typename U>
 std::vector<T> convert(const ::rust::Slice<const U>& slice) {
   std::vector<T> output;
+  output.reserve(slice.size());
   for (const auto& element : slice) {
     output.push_back(convert(element));
   }
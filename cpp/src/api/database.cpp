@@ -3,6 +3,7 @@
 
 #include "api/convert.h"
 #include "api/exception/exception.h"
+#include "api/metadata_view_access.h"
 
 namespace loot {
 Database::Database(::rust::Box<loot::rust::Database>&& database) :
@@ -97,11 +98,12 @@ void Database::SetUserGroups(const std::vector<Group>& groups) {
 std::vector<Vertex> Database::GetGroupsPath(
     std::string_view fromGroupName,
     std::string_view toGroupName) const {
+  auto errorDetails = loot::rust::new_error_details();
   try {
-    return convert<Vertex>(
-        database_->groups_path(convert(fromGroupName), convert(toGroupName)));
+    return convert<Vertex>(database_->groups_path(
+        convert(fromGroupName), convert(toGroupName), *errorDetails));
   } catch (const ::rust::Error& e) {
-    std::rethrow_exception(mapError(e));
+    std::rethrow_exception(mapError(e, *errorDetails));
   }
 }
 
@@ -122,6 +124,64 @@ std::optional<PluginMetadata> Database::GetPluginMetadata(
   }
 }
 
+std::vector<std::optional<PluginMetadata>> Database::GetPluginMetadataBatch(
+    const std::vector<std::string_view>& plugins,
+    bool includeUserMetadata,
+    bool evaluateConditions) const {
+  std::vector<::rust::Str> pluginNames;
+  pluginNames.reserve(plugins.size());
+  for (const auto& plugin : plugins) {
+    pluginNames.push_back(convert(plugin));
+  }
+
+  try {
+    const auto metadataOpts = database_->plugins_metadata(
+        ::rust::Slice<const ::rust::Str>(pluginNames),
+        includeUserMetadata,
+        evaluateConditions);
+
+    std::vector<std::optional<PluginMetadata>> metadata;
+    metadata.reserve(metadataOpts.size());
+    for (const auto& metadataOpt : metadataOpts) {
+      if (metadataOpt.is_some()) {
+        metadata.push_back(convert(metadataOpt.as_ref()));
+      } else {
+        metadata.push_back(std::nullopt);
+      }
+    }
+
+    return metadata;
+  } catch (const ::rust::Error& e) {
+    std::rethrow_exception(mapError(e));
+  }
+}
+
+std::optional<PluginMetadataView> Database::GetPluginMetadataView(
+    std::string_view plugin,
+    bool includeUserMetadata,
+    bool evaluateConditions) const {
+  try {
+    auto metadata = database_->plugin_metadata(
+        convert(plugin), includeUserMetadata, evaluateConditions);
+    if (!metadata->is_some()) {
+      return std::nullopt;
+    }
+
+    // The view shares ownership of the Rust object, so that the data it
+    // borrows lives as long as the view and its copies.
+    using Owner = loot::rust::OptionalPluginMetadata;
+    const auto owner = std::shared_ptr<const Owner>(
+        metadata.into_raw(),
+        [](Owner* pointer) { ::rust::Box<Owner>::from_raw(pointer); });
+
+    return MetadataViewAccess::pluginMetadataView(
+        std::shared_ptr<const loot::rust::PluginMetadata>(owner,
+                                                          &owner->as_ref()));
+  } catch (const ::rust::Error& e) {
+    std::rethrow_exception(mapError(e));
+  }
+}
+
 std::optional<PluginMetadata> Database::GetPluginUserMetadata(
     std::string_view plugin,
     bool evaluateConditions) const {
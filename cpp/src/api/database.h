@@ -43,6 +43,16 @@ public:
       bool includeUserMetadata = true,
       bool evaluateConditions = false) const override;
 
+  std::vector<std::optional<PluginMetadata>> GetPluginMetadataBatch(
+      const std::vector<std::string_view>& plugins,
+      bool includeUserMetadata = true,
+      bool evaluateConditions = false) const override;
+
+  std::optional<PluginMetadataView> GetPluginMetadataView(
+      std::string_view plugin,
+      bool includeUserMetadata = true,
+      bool evaluateConditions = false) const override;
+
   std::optional<PluginMetadata> GetPluginUserMetadata(
       std::string_view plugin,
       bool evaluateConditions = false) const override;
@@ -1,10 +1,16 @@
 #ifndef LOOT_API_EXCEPTION
 #define LOOT_API_EXCEPTION
 
+#include "libloot-cpp/src/lib.rs.h"
 #include "rust/cxx.h"
 
 namespace loot {
 std::exception_ptr mapError(const ::rust::Error& error);
+
+// Maps an error returned by a function that also recorded its details, so
+// that errors with a specific exception type can be mapped to it.
+std::exception_ptr mapError(const ::rust::Error& error,
+                            const loot::rust::ErrorDetails& details);
 }
 
 #endif
@@ -75,15 +75,19 @@ rust::Box<loot::rust::Game> constructGame(
     const loot::GameType gameType,
     const std::filesystem::path& gamePath,
     const std::filesystem::path& localDataPath) {
+  auto errorDetails = loot::rust::new_error_details();
   try {
     if (localDataPath.empty()) {
-      return loot::rust::new_game(convert(gameType), gamePath.u8string());
+      return loot::rust::new_game(
+          convert(gameType), gamePath.u8string(), *errorDetails);
     } else {
-      return loot::rust::new_game_with_local_path(
-          convert(gameType), gamePath.u8string(), localDataPath.u8string());
+      return loot::rust::new_game_with_local_path(convert(gameType),
+                                                  gamePath.u8string(),
+                                                  localDataPath.u8string(),
+                                                  *errorDetails);
     }
   } catch (const ::rust::Error& e) {
-    std::rethrow_exception(loot::mapError(e));
+    std::rethrow_exception(loot::mapError(e, *errorDetails));
   }
 }
 
@@ -149,6 +153,23 @@ bool Game::IsValidPlugin(const std::filesystem::path& pluginPath) const {
   return game_->is_valid_plugin(pluginPath.u8string());
 }
 
+void Game::SetPluginMemoryMapping(bool memoryMapPlugins) {
+  game_->set_plugin_memory_mapping(memoryMapPlugins);
+}
+
+void Game::SetPluginCacheDirectory(
+    const std::filesystem::path& cacheDirectory) {
+  game_->set_plugin_cache_directory(cacheDirectory.u8string());
+}
+
+void Game::SavePluginCache() {
+  try {
+    game_->save_plugin_cache();
+  } catch (const ::rust::Error& e) {
+    std::rethrow_exception(mapError(e));
+  }
+}
+
 void Game::LoadPlugins(const std::vector<std::filesystem::path>& pluginPaths,
                        bool loadHeadersOnly) {
   std::vector<::rust::String> path_strings;
@@ -158,42 +179,47 @@ void Game::LoadPlugins(const std::vector<std::filesystem::path>& pluginPaths,
     path_strs.push_back(path_strings.back());
   }
 
+  auto errorDetails = loot::rust::new_error_details();
   try {
     if (loadHeadersOnly) {
-      game_->load_plugin_headers(::rust::Slice<const ::rust::Str>(path_strs));
+      game_->load_plugin_headers(::rust::Slice<const ::rust::Str>(path_strs),
+                                 *errorDetails);
     } else {
-      game_->load_plugins(::rust::Slice<const ::rust::Str>(path_strs));
+      game_->load_plugins(::rust::Slice<const ::rust::Str>(path_strs),
+                          *errorDetails);
     }
   } catch (const ::rust::Error& e) {
-    std::rethrow_exception(mapError(e));
+    std::rethrow_exception(mapError(e, *errorDetails));
   }
 
-  std::lock_guard<std::mutex> guard(pluginsMutex_);
+  std::unique_lock<std::shared_mutex> guard(pluginsMutex_);
 
   for (const auto& path : pluginPaths) {
-    auto key = Filename(path.filename().u8string());
-    auto it = plugins_.find(key);
-    if (it != plugins_.end()) {
-      plugins_.erase(it);
-    }
+    plugins_.erase(Filename(path.filename().u8string()));
   }
+  ++pluginsGeneration_;
 }
 
 void Game::ClearLoadedPlugins() {
   game_->clear_loaded_plugins();
 
-  std::lock_guard<std::mutex> guard(pluginsMutex_);
+  std::unique_lock<std::shared_mutex> guard(pluginsMutex_);
   plugins_.clear();
+  ++pluginsGeneration_;
 }
 
 std::shared_ptr<const PluginInterface> Game::GetPlugin(
     std::string_view pluginName) const {
-  std::lock_guard<std::mutex> guard(pluginsMutex_);
-
+  const auto generation = pluginsGeneration_.load();
   auto key = Filename(pluginName);
-  const auto it = plugins_.find(key);
-  if (it != plugins_.end()) {
-    return it->second;
+
+  {
+    std::shared_lock<std::shared_mutex> guard(pluginsMutex_);
+
+    const auto it = plugins_.find(key);
+    if (it != plugins_.end()) {
+      return it->second;
+    }
   }
 
   const auto pluginOpt = game_->plugin(convert(pluginName));
@@ -205,7 +231,83 @@ std::shared_ptr<const PluginInterface> Game::GetPlugin(
     std::shared_ptr<const PluginInterface> plugin =
         std::make_shared<Plugin>(std::move(pluginOpt->as_ref().boxed_clone()));
 
-    return plugins_.emplace(key, plugin).first->second;
+    std::unique_lock<std::shared_mutex> guard(pluginsMutex_);
+
+    if (pluginsGeneration_.load() != generation) {
+      return plugin;
+    }
+
+    // Another thread may have cached the plugin since the lookup above, in
+    // which case emplace() keeps and returns its pointer.
+    return plugins_.emplace(std::move(key), plugin).first->second;
+  } catch (const ::rust::Error& e) {
+    std::rethrow_exception(mapError(e));
+  }
+}
+
+std::vector<std::shared_ptr<const PluginInterface>> Game::GetPlugins(
+    const std::vector<std::string_view>& pluginNames) const {
+  const auto generation = pluginsGeneration_.load();
+  std::vector<Filename> keys;
+  keys.reserve(pluginNames.size());
+  for (const auto& pluginName : pluginNames) {
+    keys.push_back(Filename(pluginName));
+  }
+
+  std::vector<std::shared_ptr<const PluginInterface>> plugins;
+  plugins.reserve(pluginNames.size());
+  std::vector<size_t> uncachedIndices;
+  std::vector<::rust::Str> uncachedNames;
+
+  {
+    std::shared_lock<std::shared_mutex> guard(pluginsMutex_);
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+      const auto it = plugins_.find(keys[i]);
+      if (it == plugins_.end()) {
+        uncachedIndices.push_back(i);
+        uncachedNames.push_back(convert(pluginNames[i]));
+        plugins.push_back(nullptr);
+      } else {
+        plugins.push_back(it->second);
+      }
+    }
+  }
+
+  if (uncachedIndices.empty()) {
+    return plugins;
+  }
+
+  try {
+    const auto pluginOpts =
+        game_->plugins(::rust::Slice<const ::rust::Str>(uncachedNames));
+
+    std::unique_lock<std::shared_mutex> guard(pluginsMutex_);
+
+    const auto isCacheCurrent = pluginsGeneration_.load() == generation;
+
+    for (size_t i = 0; i < uncachedIndices.size(); ++i) {
+      const auto& pluginOpt = pluginOpts[i];
+      if (!pluginOpt.is_some()) {
+        continue;
+      }
+
+      const auto index = uncachedIndices[i];
+      const auto it = plugins_.find(keys[index]);
+      if (isCacheCurrent && it != plugins_.end()) {
+        plugins[index] = it->second;
+        continue;
+      }
+
+      std::shared_ptr<const PluginInterface> plugin = std::make_shared<Plugin>(
+          std::move(pluginOpt.as_ref().boxed_clone()));
+      if (isCacheCurrent) {
+        plugins_.emplace(keys[index], plugin);
+      }
+      plugins[index] = plugin;
+    }
+
+    return plugins;
   } catch (const ::rust::Error& e) {
     std::rethrow_exception(mapError(e));
   }
@@ -213,33 +315,73 @@ std::shared_ptr<const PluginInterface> Game::GetPlugin(
 
 std::vector<std::shared_ptr<const PluginInterface>> Game::GetLoadedPlugins()
     const {
-  std::lock_guard<std::mutex> guard(pluginsMutex_);
+  const auto generation = pluginsGeneration_.load();
+  const auto loadedPlugins = game_->loaded_plugins();
+
+  std::vector<Filename> keys;
+  keys.reserve(loadedPlugins.size());
+  for (const auto& pluginRef : loadedPlugins) {
+    keys.push_back(Filename(convert(pluginRef.name())));
+  }
 
   std::vector<std::shared_ptr<const PluginInterface>> plugins;
-  for (const auto& pluginRef : game_->loaded_plugins()) {
-    auto key = Filename(convert(pluginRef.name()));
-    auto it = plugins_.find(key);
-    if (it == plugins_.end()) {
+  plugins.reserve(loadedPlugins.size());
+  std::vector<size_t> uncachedIndices;
+
+  {
+    std::shared_lock<std::shared_mutex> guard(pluginsMutex_);
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+      const auto it = plugins_.find(keys[i]);
+      if (it == plugins_.end()) {
+        uncachedIndices.push_back(i);
+        plugins.push_back(nullptr);
+      } else {
+        plugins.push_back(it->second);
+      }
+    }
+  }
+
+  if (!uncachedIndices.empty()) {
+    std::unique_lock<std::shared_mutex> guard(pluginsMutex_);
+
+    const auto isCacheCurrent = pluginsGeneration_.load() == generation;
+
+    for (const auto i : uncachedIndices) {
+      const auto it = plugins_.find(keys[i]);
+      if (isCacheCurrent && it != plugins_.end()) {
+        plugins[i] = it->second;
+        continue;
+      }
+
       std::shared_ptr<const PluginInterface> plugin =
-          std::make_shared<Plugin>(std::move(pluginRef.boxed_clone()));
-      it = plugins_.emplace(key, plugin).first;
+          std::make_shared<Plugin>(std::move(loadedPlugins[i].boxed_clone()));
+      if (isCacheCurrent) {
+        plugins_.emplace(keys[i], plugin);
+      }
+      plugins[i] = plugin;
     }
-    plugins.push_back(it->second);
   }
 
   return plugins;
 }
 
+void Game::SetSortResultCaching(bool cacheSortResults) {
+  game_->set_sort_result_caching(cacheSortResults);
+}
+
 std::vector<std::string> Game::SortPlugins(
     const std::vector<std::string>& pluginFilenames) {
   const auto strs = asStrRefs(pluginFilenames);
 
+  auto errorDetails = loot::rust::new_error_details();
   try {
-    const auto results = game_->sort_plugins(::rust::Slice(strs));
+    const auto results =
+        game_->sort_plugins(::rust::Slice(strs), *errorDetails);
 
     return convert<std::string>(results);
   } catch (const ::rust::Error& e) {
-    std::rethrow_exception(mapError(e));
+    std::rethrow_exception(mapError(e, *errorDetails));
   }
 }
 
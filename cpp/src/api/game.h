@@ -1,8 +1,10 @@
 #ifndef LOOT_API_GAME
 #define LOOT_API_GAME
 
-#include <map>
-#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "api/database.h"
 #include "api/plugin.h"
@@ -30,6 +32,13 @@ public:
 
   bool IsValidPlugin(const std::filesystem::path& pluginPath) const override;
 
+  void SetPluginMemoryMapping(bool memoryMapPlugins) override;
+
+  void SetPluginCacheDirectory(
+      const std::filesystem::path& cacheDirectory) override;
+
+  void SavePluginCache() override;
+
   void LoadPlugins(const std::vector<std::filesystem::path>& pluginPaths,
                    bool loadHeadersOnly) override;
 
@@ -38,9 +47,14 @@ public:
   std::shared_ptr<const PluginInterface> GetPlugin(
       std::string_view pluginName) const override;
 
+  std::vector<std::shared_ptr<const PluginInterface>> GetPlugins(
+      const std::vector<std::string_view>& pluginNames) const override;
+
   std::vector<std::shared_ptr<const PluginInterface>> GetLoadedPlugins()
       const override;
 
+  void SetSortResultCaching(bool cacheSortResults) override;
+
   std::vector<std::string> SortPlugins(
       const std::vector<std::string>& pluginFilenames) override;
 
@@ -60,8 +74,15 @@ private:
   ::rust::Box<loot::rust::Game> game_;
   Database database_;
 
-  mutable std::map<Filename, std::shared_ptr<const PluginInterface>> plugins_;
-  mutable std::mutex pluginsMutex_;
+  mutable std::unordered_map<Filename, std::shared_ptr<const PluginInterface>>
+      plugins_;
+  // Lookups only need a shared lock, so concurrent readers don't contend.
+  mutable std::shared_mutex pluginsMutex_;
+  // Incremented while holding pluginsMutex_ whenever cached plugins are
+  // invalidated. Readers fetch plugins without holding the lock, so they only
+  // cache a fetched plugin if the generation hasn't changed since they
+  // started, as otherwise the plugin may be from before the invalidation.
+  std::atomic<uint64_t> pluginsGeneration_{0};
 };
 }
 
@@ -38,57 +38,70 @@ File::File(std::string_view name,
 
 Filename File::GetName() const { return name_; }
 
+const Filename& File::GetNameRef() const { return name_; }
+
 std::string File::GetDisplayName() const { return display_; }
 
+const std::string& File::GetDisplayNameRef() const { return display_; }
+
 std::vector<MessageContent> File::GetDetail() const { return detail_; }
 
+const std::vector<MessageContent>& File::GetDetailRef() const {
+  return detail_;
+}
+
 std::string File::GetCondition() const { return condition_; }
 
+const std::string& File::GetConditionRef() const { return condition_; }
+
 std::string File::GetConstraint() const { return constraint_; }
 
+const std::string& File::GetConstraintRef() const { return constraint_; }
+
 bool operator==(const File& lhs, const File& rhs) {
-  return lhs.GetDisplayName() == rhs.GetDisplayName() &&
-         lhs.GetCondition() == rhs.GetCondition() &&
-         lhs.GetConstraint() == rhs.GetConstraint() &&
-         lhs.GetName() == rhs.GetName() && lhs.GetDetail() == rhs.GetDetail();
+  return lhs.GetDisplayNameRef() == rhs.GetDisplayNameRef() &&
+         lhs.GetConditionRef() == rhs.GetConditionRef() &&
+         lhs.GetConstraintRef() == rhs.GetConstraintRef() &&
+         lhs.GetNameRef() == rhs.GetNameRef() &&
+         lhs.GetDetailRef() == rhs.GetDetailRef();
 }
 
 bool operator!=(const File& lhs, const File& rhs) { return !(lhs == rhs); }
 
 bool operator<(const File& lhs, const File& rhs) {
-  if (lhs.GetDisplayName() < rhs.GetDisplayName()) {
+  if (lhs.GetDisplayNameRef() < rhs.GetDisplayNameRef()) {
     return true;
   }
 
-  if (rhs.GetDisplayName() < lhs.GetDisplayName()) {
+  if (rhs.GetDisplayNameRef() < lhs.GetDisplayNameRef()) {
     return false;
   }
 
-  if (lhs.GetCondition() < rhs.GetCondition()) {
+  if (lhs.GetConditionRef() < rhs.GetConditionRef()) {
     return true;
   }
 
-  if (rhs.GetCondition() < lhs.GetCondition()) {
+  if (rhs.GetConditionRef() < lhs.GetConditionRef()) {
     return false;
   }
 
-  if (lhs.GetConstraint() < rhs.GetConstraint()) {
+  if (lhs.GetConstraintRef() < rhs.GetConstraintRef()) {
     return true;
   }
 
-  if (rhs.GetConstraint() < lhs.GetConstraint()) {
+  if (rhs.GetConstraintRef() < lhs.GetConstraintRef()) {
     return false;
   }
 
-  if (lhs.GetName() < rhs.GetName()) {
+  if (lhs.GetNameRef() < rhs.GetNameRef()) {
     return true;
   }
 
-  if (rhs.GetName() < lhs.GetName()) {
+  if (rhs.GetNameRef() < lhs.GetNameRef()) {
     return false;
   }
 
-  return lhs.GetDetail() < rhs.GetDetail();
+  return lhs.GetDetailRef() < rhs.GetDetailRef();
 }
 
 bool operator>(const File& lhs, const File& rhs) { return rhs < lhs; }
@@ -24,18 +24,43 @@
 
 #include "loot/metadata/filename.h"
 
-#include <stdexcept>
+#include <algorithm>
 
+#include "api/convert.h"
 #include "libloot-cpp/src/lib.rs.h"
 
+namespace {
+bool isAscii(std::string_view string) {
+  return std::all_of(string.begin(), string.end(), [](char c) {
+    return static_cast<unsigned char>(c) < 0x80;
+  });
+}
+
+// Case-fold the given filename so that bytewise comparisons of the result give
+// the same results as the case-insensitive comparisons that libloot's Rust
+// Filename type performs. ASCII strings are folded locally, as that's the
+// common case and avoids crossing the FFI boundary.
+std::string foldCase(std::string_view filename) {
+  if (isAscii(filename)) {
+    std::string folded(filename);
+    std::transform(folded.begin(), folded.end(), folded.begin(), [](char c) {
+      return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+    });
+    return folded;
+  }
+
+  return std::string(loot::rust::fold_filename_case(loot::convert(filename)));
+}
+}
+
 namespace loot {
-Filename::Filename(std::string_view filename) : filename_(filename) {}
+Filename::Filename(std::string_view filename) :
+    filename_(filename), foldedFilename_(foldCase(filename)) {}
 
 Filename::operator std::string() const { return filename_; }
 
 bool operator==(const Filename& lhs, const Filename& rhs) {
-  return loot::rust::new_filename(lhs.filename_)
-      ->eq(*loot::rust::new_filename(rhs.filename_));
+  return lhs.foldedFilename_ == rhs.foldedFilename_;
 }
 
 bool operator!=(const Filename& lhs, const Filename& rhs) {
@@ -43,8 +68,7 @@ bool operator!=(const Filename& lhs, const Filename& rhs) {
 }
 
 bool operator<(const Filename& lhs, const Filename& rhs) {
-  return loot::rust::new_filename(lhs.filename_)
-             ->lt(*loot::rust::new_filename(rhs.filename_));
+  return lhs.foldedFilename_ < rhs.foldedFilename_;
 }
 
 bool operator>(const Filename& lhs, const Filename& rhs) { return rhs < lhs; }
@@ -57,3 +81,10 @@ bool operator>=(const Filename& lhs, const Filename& rhs) {
   return !(lhs < rhs);
 }
 }
+
+namespace std {
+size_t hash<loot::Filename>::operator()(
+    const loot::Filename& filename) const noexcept {
+  return hash<string>()(filename.foldedFilename_);
+}
+}
@@ -32,36 +32,44 @@ Group::Group(std::string_view name,
 
 std::string Group::GetName() const { return name_; }
 
+const std::string& Group::GetNameRef() const { return name_; }
+
 std::string Group::GetDescription() const { return description_; }
 
+const std::string& Group::GetDescriptionRef() const { return description_; }
+
 std::vector<std::string> Group::GetAfterGroups() const { return afterGroups_; }
 
+const std::vector<std::string>& Group::GetAfterGroupsRef() const {
+  return afterGroups_;
+}
+
 bool operator==(const Group& lhs, const Group& rhs) {
-  return lhs.GetName() == rhs.GetName() &&
-         lhs.GetDescription() == rhs.GetDescription() &&
-         lhs.GetAfterGroups() == rhs.GetAfterGroups();
+  return lhs.GetNameRef() == rhs.GetNameRef() &&
+         lhs.GetDescriptionRef() == rhs.GetDescriptionRef() &&
+         lhs.GetAfterGroupsRef() == rhs.GetAfterGroupsRef();
 }
 
 bool operator!=(const Group& lhs, const Group& rhs) { return !(lhs == rhs); }
 
 bool operator<(const Group& lhs, const Group& rhs) {
-  if (lhs.GetName() < rhs.GetName()) {
+  if (lhs.GetNameRef() < rhs.GetNameRef()) {
     return true;
   }
 
-  if (rhs.GetName() < lhs.GetName()) {
+  if (rhs.GetNameRef() < lhs.GetNameRef()) {
     return false;
   }
 
-  if (lhs.GetDescription() < rhs.GetDescription()) {
+  if (lhs.GetDescriptionRef() < rhs.GetDescriptionRef()) {
     return true;
   }
 
-  if (rhs.GetDescription() < lhs.GetDescription()) {
+  if (rhs.GetDescriptionRef() < lhs.GetDescriptionRef()) {
     return false;
   }
 
-  return lhs.GetAfterGroups() < rhs.GetAfterGroups();
+  return lhs.GetAfterGroupsRef() < rhs.GetAfterGroupsRef();
 }
 
 bool operator>(const Group& lhs, const Group& rhs) { return rhs < lhs; }
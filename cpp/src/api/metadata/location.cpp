@@ -30,10 +30,15 @@ Location::Location(std::string_view url, std::string_view name) :
 
 std::string Location::GetURL() const { return url_; }
 
+const std::string& Location::GetURLRef() const { return url_; }
+
 std::string Location::GetName() const { return name_; }
 
+const std::string& Location::GetNameRef() const { return name_; }
+
 bool operator==(const Location& lhs, const Location& rhs) {
-  return lhs.GetURL() == rhs.GetURL() && lhs.GetName() == rhs.GetName();
+  return lhs.GetURLRef() == rhs.GetURLRef() &&
+         lhs.GetNameRef() == rhs.GetNameRef();
 }
 
 bool operator!=(const Location& lhs, const Location& rhs) {
@@ -41,15 +46,15 @@ bool operator!=(const Location& lhs, const Location& rhs) {
 }
 
 bool operator<(const Location& lhs, const Location& rhs) {
-  if (lhs.GetURL() < rhs.GetURL()) {
+  if (lhs.GetURLRef() < rhs.GetURLRef()) {
     return true;
   }
 
-  if (rhs.GetURL() < lhs.GetURL()) {
+  if (rhs.GetURLRef() < lhs.GetURLRef()) {
     return false;
   }
 
-  return lhs.GetName() < rhs.GetName();
+  return lhs.GetNameRef() < rhs.GetNameRef();
 }
 
 bool operator>(const Location& lhs, const Location& rhs) { return rhs < lhs; }
@@ -39,7 +39,7 @@ Message::Message(const MessageType type,
   if (content.size() > 1) {
     bool englishStringExists = false;
     for (const auto& mc : content) {
-      if (mc.GetLanguage() == MessageContent::DEFAULT_LANGUAGE)
+      if (mc.GetLanguageRef() == MessageContent::DEFAULT_LANGUAGE)
         englishStringExists = true;
     }
     if (!englishStringExists)
@@ -53,12 +53,18 @@ MessageType Message::GetType() const { return type_; }
 
 std::vector<MessageContent> Message::GetContent() const { return content_; }
 
+const std::vector<MessageContent>& Message::GetContentRef() const {
+  return content_;
+}
+
 std::string Message::GetCondition() const { return condition_; }
 
+const std::string& Message::GetConditionRef() const { return condition_; }
+
 bool operator==(const Message& lhs, const Message& rhs) {
   return lhs.GetType() == rhs.GetType() &&
-         lhs.GetCondition() == rhs.GetCondition() &&
-         lhs.GetContent() == rhs.GetContent();
+         lhs.GetConditionRef() == rhs.GetConditionRef() &&
+         lhs.GetContentRef() == rhs.GetContentRef();
 }
 
 bool operator!=(const Message& lhs, const Message& rhs) {
@@ -74,15 +80,15 @@ bool operator<(const Message& lhs, const Message& rhs) {
     return false;
   }
 
-  if (lhs.GetCondition() < rhs.GetCondition()) {
+  if (lhs.GetConditionRef() < rhs.GetConditionRef()) {
     return true;
   }
 
-  if (rhs.GetCondition() < lhs.GetCondition()) {
+  if (rhs.GetConditionRef() < lhs.GetConditionRef()) {
     return false;
   }
 
-  return lhs.GetContent() < rhs.GetContent();
+  return lhs.GetContentRef() < rhs.GetContentRef();
 }
 
 bool operator>(const Message& lhs, const Message& rhs) { return rhs < lhs; }
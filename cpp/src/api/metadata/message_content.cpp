@@ -31,11 +31,15 @@ MessageContent::MessageContent(std::string_view text,
 
 std::string MessageContent::GetText() const { return text_; }
 
+const std::string& MessageContent::GetTextRef() const { return text_; }
+
 std::string MessageContent::GetLanguage() const { return language_; }
 
+const std::string& MessageContent::GetLanguageRef() const { return language_; }
+
 bool operator==(const MessageContent& lhs, const MessageContent& rhs) {
-  return lhs.GetText() == rhs.GetText() &&
-         lhs.GetLanguage() == rhs.GetLanguage();
+  return lhs.GetTextRef() == rhs.GetTextRef() &&
+         lhs.GetLanguageRef() == rhs.GetLanguageRef();
 }
 
 bool operator!=(const MessageContent& lhs, const MessageContent& rhs) {
@@ -43,15 +47,15 @@ bool operator!=(const MessageContent& lhs, const MessageContent& rhs) {
 }
 
 bool operator<(const MessageContent& lhs, const MessageContent& rhs) {
-  if (lhs.GetText() < rhs.GetText()) {
+  if (lhs.GetTextRef() < rhs.GetTextRef()) {
     return true;
   }
 
-  if (rhs.GetText() < lhs.GetText()) {
+  if (rhs.GetTextRef() < lhs.GetTextRef()) {
     return false;
   }
 
-  return lhs.GetLanguage() < rhs.GetLanguage();
+  return lhs.GetLanguageRef() < rhs.GetLanguageRef();
 }
 
 bool operator>(const MessageContent& lhs, const MessageContent& rhs) {
@@ -80,7 +84,7 @@ std::optional<MessageContent> SelectMessageContent(
     std::optional<MessageContent> matchedLanguage;
     std::optional<MessageContent> english;
     for (const auto& mc : content) {
-      auto contentLanguage = mc.GetLanguage();
+      const auto& contentLanguage = mc.GetLanguageRef();
 
       if (contentLanguage == language) {
         return mc;
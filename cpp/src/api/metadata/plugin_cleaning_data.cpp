@@ -54,17 +54,25 @@ unsigned int PluginCleaningData::GetDeletedNavmeshCount() const { return nav_; }
 
 std::string PluginCleaningData::GetCleaningUtility() const { return utility_; }
 
+const std::string& PluginCleaningData::GetCleaningUtilityRef() const {
+  return utility_;
+}
+
 std::vector<MessageContent> PluginCleaningData::GetDetail() const {
   return detail_;
 }
 
+const std::vector<MessageContent>& PluginCleaningData::GetDetailRef() const {
+  return detail_;
+}
+
 bool operator==(const PluginCleaningData& lhs, const PluginCleaningData& rhs) {
   return lhs.GetCRC() == rhs.GetCRC() &&
          lhs.GetITMCount() == rhs.GetITMCount() &&
          lhs.GetDeletedReferenceCount() == rhs.GetDeletedReferenceCount() &&
          lhs.GetDeletedNavmeshCount() == rhs.GetDeletedNavmeshCount() &&
-         lhs.GetCleaningUtility() == rhs.GetCleaningUtility() &&
-         lhs.GetDetail() == rhs.GetDetail();
+         lhs.GetCleaningUtilityRef() == rhs.GetCleaningUtilityRef() &&
+         lhs.GetDetailRef() == rhs.GetDetailRef();
 }
 
 bool operator!=(const PluginCleaningData& lhs, const PluginCleaningData& rhs) {
@@ -80,11 +88,11 @@ bool operator<(const PluginCleaningData& lhs, const PluginCleaningData& rhs) {
     return false;
   }
 
-  if (lhs.GetCleaningUtility() < rhs.GetCleaningUtility()) {
+  if (lhs.GetCleaningUtilityRef() < rhs.GetCleaningUtilityRef()) {
     return true;
   }
 
-  if (rhs.GetCleaningUtility() < lhs.GetCleaningUtility()) {
+  if (rhs.GetCleaningUtilityRef() < lhs.GetCleaningUtilityRef()) {
     return false;
   }
 
@@ -112,7 +120,7 @@ bool operator<(const PluginCleaningData& lhs, const PluginCleaningData& rhs) {
     return false;
   }
 
-  return lhs.GetDetail() < rhs.GetDetail();
+  return lhs.GetDetailRef() < rhs.GetDetailRef();
 }
 
 bool operator>(const PluginCleaningData& lhs, const PluginCleaningData& rhs) {
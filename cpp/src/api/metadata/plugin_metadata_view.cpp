@@ -0,0 +1,194 @@
+/*  LOOT
+
+    A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+    Fallout: New Vegas.
+
+    Copyright (C) 2025    WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "loot/metadata/plugin_metadata_view.h"
+
+#include "api/convert.h"
+#include "api/metadata_view_access.h"
+
+namespace {
+using loot::MetadataViewAccess;
+
+template<typename T>
+const T& get(const std::shared_ptr<const void>& data) {
+  return MetadataViewAccess::get<T>(data);
+}
+
+template<typename View, typename T>
+loot::MetadataViewList<View> toViewList(
+    const std::shared_ptr<const void>& owner,
+    ::rust::Slice<const T> slice) {
+  return MetadataViewAccess::toViewList<View>(owner, slice);
+}
+}
+
+namespace loot {
+std::string_view MessageContentView::GetText() const {
+  return convert(get<rust::MessageContent>(content_).text());
+}
+
+std::string_view MessageContentView::GetLanguage() const {
+  return convert(get<rust::MessageContent>(content_).language());
+}
+
+std::string_view FileView::GetName() const {
+  return convert(get<rust::File>(file_).filename().as_str());
+}
+
+std::string_view FileView::GetDisplayName() const {
+  return convert(get<rust::File>(file_).display_name());
+}
+
+MetadataViewList<MessageContentView> FileView::GetDetail() const {
+  return toViewList<MessageContentView>(file_, get<rust::File>(file_).detail());
+}
+
+std::string_view FileView::GetCondition() const {
+  return convert(get<rust::File>(file_).condition());
+}
+
+std::string_view FileView::GetConstraint() const {
+  return convert(get<rust::File>(file_).constraint());
+}
+
+std::string_view LocationView::GetURL() const {
+  return convert(get<rust::Location>(location_).url());
+}
+
+std::string_view LocationView::GetName() const {
+  return convert(get<rust::Location>(location_).name());
+}
+
+MessageType MessageView::GetType() const {
+  return convert(get<rust::Message>(message_).message_type());
+}
+
+MetadataViewList<MessageContentView> MessageView::GetContent() const {
+  return toViewList<MessageContentView>(
+      message_, get<rust::Message>(message_).content());
+}
+
+std::string_view MessageView::GetCondition() const {
+  return convert(get<rust::Message>(message_).condition());
+}
+
+uint32_t PluginCleaningDataView::GetCRC() const {
+  return get<rust::PluginCleaningData>(data_).crc();
+}
+
+unsigned int PluginCleaningDataView::GetITMCount() const {
+  return get<rust::PluginCleaningData>(data_).itm_count();
+}
+
+unsigned int PluginCleaningDataView::GetDeletedReferenceCount() const {
+  return get<rust::PluginCleaningData>(data_).deleted_reference_count();
+}
+
+unsigned int PluginCleaningDataView::GetDeletedNavmeshCount() const {
+  return get<rust::PluginCleaningData>(data_).deleted_navmesh_count();
+}
+
+std::string_view PluginCleaningDataView::GetCleaningUtility() const {
+  return convert(get<rust::PluginCleaningData>(data_).cleaning_utility());
+}
+
+MetadataViewList<MessageContentView> PluginCleaningDataView::GetDetail()
+    const {
+  return toViewList<MessageContentView>(
+      data_, get<rust::PluginCleaningData>(data_).detail());
+}
+
+bool TagView::IsAddition() const { return get<rust::Tag>(tag_).is_addition(); }
+
+std::string_view TagView::GetName() const {
+  return convert(get<rust::Tag>(tag_).name());
+}
+
+std::string_view TagView::GetCondition() const {
+  return convert(get<rust::Tag>(tag_).condition());
+}
+
+std::string_view PluginMetadataView::GetName() const {
+  return convert(get<rust::PluginMetadata>(metadata_).name());
+}
+
+std::optional<std::string_view> PluginMetadataView::GetGroup() const {
+  const auto group = convert(get<rust::PluginMetadata>(metadata_).group());
+  if (group.empty()) {
+    return std::nullopt;
+  }
+
+  return group;
+}
+
+MetadataViewList<FileView> PluginMetadataView::GetLoadAfterFiles() const {
+  return toViewList<FileView>(
+      metadata_, get<rust::PluginMetadata>(metadata_).load_after_files());
+}
+
+MetadataViewList<FileView> PluginMetadataView::GetRequirements() const {
+  return toViewList<FileView>(
+      metadata_, get<rust::PluginMetadata>(metadata_).requirements());
+}
+
+MetadataViewList<FileView> PluginMetadataView::GetIncompatibilities() const {
+  return toViewList<FileView>(
+      metadata_, get<rust::PluginMetadata>(metadata_).incompatibilities());
+}
+
+MetadataViewList<MessageView> PluginMetadataView::GetMessages() const {
+  return toViewList<MessageView>(
+      metadata_, get<rust::PluginMetadata>(metadata_).messages());
+}
+
+MetadataViewList<TagView> PluginMetadataView::GetTags() const {
+  return toViewList<TagView>(metadata_,
+                             get<rust::PluginMetadata>(metadata_).tags());
+}
+
+MetadataViewList<PluginCleaningDataView> PluginMetadataView::GetDirtyInfo()
+    const {
+  return toViewList<PluginCleaningDataView>(
+      metadata_, get<rust::PluginMetadata>(metadata_).dirty_info());
+}
+
+MetadataViewList<PluginCleaningDataView> PluginMetadataView::GetCleanInfo()
+    const {
+  return toViewList<PluginCleaningDataView>(
+      metadata_, get<rust::PluginMetadata>(metadata_).clean_info());
+}
+
+MetadataViewList<LocationView> PluginMetadataView::GetLocations() const {
+  return toViewList<LocationView>(
+      metadata_, get<rust::PluginMetadata>(metadata_).locations());
+}
+
+bool PluginMetadataView::HasNameOnly() const {
+  return get<rust::PluginMetadata>(metadata_).has_name_only();
+}
+
+bool PluginMetadataView::IsRegexPlugin() const {
+  return get<rust::PluginMetadata>(metadata_).is_regex_plugin();
+}
+}
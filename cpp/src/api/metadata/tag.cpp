@@ -34,12 +34,16 @@ bool Tag::IsAddition() const { return addTag_; }
 
 std::string Tag::GetName() const { return name_; }
 
+const std::string& Tag::GetNameRef() const { return name_; }
+
 std::string Tag::GetCondition() const { return condition_; }
 
+const std::string& Tag::GetConditionRef() const { return condition_; }
+
 bool operator==(const Tag& lhs, const Tag& rhs) {
   return lhs.IsAddition() == rhs.IsAddition() &&
-         lhs.GetName() == rhs.GetName() &&
-         lhs.GetCondition() == rhs.GetCondition();
+         lhs.GetNameRef() == rhs.GetNameRef() &&
+         lhs.GetConditionRef() == rhs.GetConditionRef();
 }
 
 bool operator!=(const Tag& lhs, const Tag& rhs) { return !(lhs == rhs); }
@@ -49,15 +53,15 @@ bool operator<(const Tag& lhs, const Tag& rhs) {
     return lhs.IsAddition() && !rhs.IsAddition();
   }
 
-  if (lhs.GetName() < rhs.GetName()) {
+  if (lhs.GetNameRef() < rhs.GetNameRef()) {
     return true;
   }
 
-  if (rhs.GetName() < lhs.GetName()) {
+  if (rhs.GetNameRef() < lhs.GetNameRef()) {
     return false;
   }
 
-  return lhs.GetCondition() < rhs.GetCondition();
+  return lhs.GetConditionRef() < rhs.GetConditionRef();
 }
 
 bool operator>(const Tag& lhs, const Tag& rhs) { return rhs < lhs; }
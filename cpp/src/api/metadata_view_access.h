@@ -0,0 +1,49 @@
+#ifndef LOOT_API_METADATA_VIEW_ACCESS
+#define LOOT_API_METADATA_VIEW_ACCESS
+
+#include <memory>
+
+#include "libloot-cpp/src/lib.rs.h"
+#include "loot/metadata/plugin_metadata_view.h"
+#include "rust/cxx.h"
+
+namespace loot {
+// Creates metadata views and gets the Rust objects that they view. Each view
+// holds a shared_ptr that points to the object that it views and that shares
+// ownership of the PluginMetadata object that contains it.
+class MetadataViewAccess {
+public:
+  static PluginMetadataView pluginMetadataView(
+      std::shared_ptr<const loot::rust::PluginMetadata> metadata) {
+    return PluginMetadataView(std::move(metadata));
+  }
+
+  template<typename View, typename T>
+  static MetadataViewList<View> toViewList(
+      const std::shared_ptr<const void>& owner,
+      ::rust::Slice<const T> slice) {
+    return MetadataViewList<View>(
+        std::shared_ptr<const void>(owner, slice.data()),
+        slice.size(),
+        &viewAt<View, T>);
+  }
+
+  template<typename T>
+  static const T& get(const std::shared_ptr<const void>& data) {
+    return *static_cast<const T*>(data.get());
+  }
+
+private:
+  template<typename View, typename T>
+  static View viewAt(const std::shared_ptr<const void>& data,
+                     size_t size,
+                     size_t index) {
+    const auto slice =
+        ::rust::Slice<const T>(static_cast<const T*>(data.get()), size);
+
+    return View(std::shared_ptr<const void>(data, &slice[index]));
+  }
+};
+}
+
+#endif
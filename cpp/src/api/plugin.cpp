@@ -10,7 +10,13 @@ namespace loot {
 Plugin::Plugin(::rust::Box<loot::rust::Plugin> plugin) :
     plugin_(std::move(plugin)) {}
 
-std::string Plugin::GetName() const { return std::string(plugin_->name()); }
+std::string Plugin::GetName() const { return GetNameRef(); }
+
+const std::string& Plugin::GetNameRef() const {
+  std::call_once(nameFlag_, [this]() { name_ = std::string(plugin_->name()); });
+
+  return name_;
+}
 
 std::optional<float> Plugin::GetHeaderVersion() const {
   const auto value = plugin_->header_version();
@@ -22,24 +28,51 @@ std::optional<float> Plugin::GetHeaderVersion() const {
 }
 
 std::optional<std::string> Plugin::GetVersion() const {
-  const auto value = plugin_->version();
-  if (value.empty()) {
-    return std::nullopt;
-  } else {
-    return std::string(value);
-  }
+  return GetVersionRef();
 }
 
-std::vector<std::string> Plugin::GetMasters() const {
-  try {
-    return convert<std::string>(plugin_->masters());
-  } catch (const ::rust::Error& e) {
-    std::rethrow_exception(mapError(e));
+const std::optional<std::string>& Plugin::GetVersionRef() const {
+  std::call_once(versionFlag_, [this]() {
+    const auto value = plugin_->version();
+    if (!value.empty()) {
+      version_ = std::string(value);
+    }
+  });
+
+  return version_;
+}
+
+std::vector<std::string> Plugin::GetMasters() const { return GetMastersRef(); }
+
+const std::vector<std::string>& Plugin::GetMastersRef() const {
+  // The plugin's data doesn't change, so if reading its masters fails once it
+  // will always fail, and the error can be cached too. This also avoids
+  // throwing through std::call_once.
+  std::call_once(mastersFlag_, [this]() {
+    try {
+      masters_ = convert<std::string>(plugin_->masters());
+    } catch (const ::rust::Error& e) {
+      mastersError_ = mapError(e);
+    }
+  });
+
+  if (mastersError_) {
+    std::rethrow_exception(mastersError_);
   }
+
+  return masters_;
 }
 
 std::vector<std::string> Plugin::GetBashTags() const {
-  return convert<std::string>(plugin_->bash_tags());
+  return GetBashTagsRef();
+}
+
+const std::vector<std::string>& Plugin::GetBashTagsRef() const {
+  std::call_once(bashTagsFlag_, [this]() {
+    bashTags_ = convert<std::string>(plugin_->bash_tags());
+  });
+
+  return bashTags_;
 }
 
 std::optional<uint32_t> Plugin::GetCRC() const {
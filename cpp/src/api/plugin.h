@@ -3,6 +3,8 @@
 #define LOOT_API_PLUGIN
 
 #include <cstdint>
+#include <exception>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -19,10 +21,14 @@ public:
   explicit Plugin(::rust::Box<loot::rust::Plugin> plugin);
 
   std::string GetName() const override;
+  const std::string& GetNameRef() const override;
   std::optional<float> GetHeaderVersion() const override;
   std::optional<std::string> GetVersion() const override;
+  const std::optional<std::string>& GetVersionRef() const override;
   std::vector<std::string> GetMasters() const override;
+  const std::vector<std::string>& GetMastersRef() const override;
   std::vector<std::string> GetBashTags() const override;
+  const std::vector<std::string>& GetBashTagsRef() const override;
   std::optional<uint32_t> GetCRC() const override;
 
   bool IsMaster() const override;
@@ -40,6 +46,18 @@ public:
 
 private:
   ::rust::Box<loot::rust::Plugin> plugin_;
+
+  // A loaded plugin's data never changes, so these fields are converted from
+  // the Rust data the first time they're requested and then reused.
+  mutable std::once_flag nameFlag_;
+  mutable std::string name_;
+  mutable std::once_flag versionFlag_;
+  mutable std::optional<std::string> version_;
+  mutable std::once_flag mastersFlag_;
+  mutable std::vector<std::string> masters_;
+  mutable std::exception_ptr mastersError_;
+  mutable std::once_flag bashTagsFlag_;
+  mutable std::vector<std::string> bashTags_;
 };
 }
 
@@ -9,6 +9,7 @@ use libloot_ffi_errors::UnsupportedEnumValueError;
 
 use crate::{
     OptionalPluginMetadata, VerboseError,
+    error::ErrorDetails,
     ffi::EdgeType,
     metadata::{Group, Message, PluginMetadata, to_vec_of_unwrapped},
 };
@@ -152,13 +153,16 @@ impl Database {
         &self,
         from_group_name: &str,
         to_group_name: &str,
+        error_details: &mut ErrorDetails,
     ) -> Result<Vec<Vertex>, VerboseError> {
-        self.0
-            .read()
-            .map_err(DatabaseLockPoisonError::from)?
-            .groups_path(from_group_name, to_group_name)
+        error_details
+            .record(
+                self.0
+                    .read()
+                    .map_err(DatabaseLockPoisonError::from)?
+                    .groups_path(from_group_name, to_group_name),
+            )
             .map(|v| v.into_iter().map(Into::into).collect())
-            .map_err(Into::into)
     }
 
     pub fn plugin_metadata(
@@ -179,6 +183,24 @@ impl Database {
             .map_err(Into::into)
     }
 
+    pub fn plugins_metadata(
+        &self,
+        plugin_names: &[&str],
+        include_user_metadata: bool,
+        evaluate_conditions: bool,
+    ) -> Result<Vec<OptionalPluginMetadata>, VerboseError> {
+        self.0
+            .read()
+            .map_err(DatabaseLockPoisonError::from)?
+            .plugins_metadata(
+                plugin_names,
+                to_merge_mode(include_user_metadata),
+                to_eval_mode(evaluate_conditions),
+            )
+            .map(|v| v.into_iter().map(|p| p.map(Into::into).into()).collect())
+            .map_err(Into::into)
+    }
+
     pub fn plugin_user_metadata(
         &self,
         plugin_name: &str,
@@ -1,4 +1,6 @@
-use crate::game::NotValidUtf8;
+use std::io::Error as IoError;
+
+use crate::{database::Vertex, ffi::ErrorCode, game::NotValidUtf8};
 use libloot_ffi_errors::{UnsupportedEnumValueError, fmt_error_chain, variant_box_from_error};
 
 use libloot::{
@@ -25,15 +27,7 @@ impl std::fmt::Display for VerboseError {
     fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
         match self {
             Self::CyclicInteractionError(cycle) => {
-                write!(f, "CyclicInteractionError: ")?;
-                for vertex in cycle {
-                    let name = vertex.name().replace('\\', "\\\\").replace('>', "\\>");
-                    match vertex.out_edge_type() {
-                        Some(e) => write!(f, "{name} > {e} > ")?,
-                        None => write!(f, "{name}")?,
-                    }
-                }
-                Ok(())
+                write!(f, "CyclicInteractionError: {}", fmt_cycle(cycle))
             }
             Self::UndefinedGroupError(group) => {
                 write!(f, "UndefinedGroupError: {group}",)
@@ -48,6 +42,103 @@ impl std::fmt::Display for VerboseError {
     }
 }
 
+/// The structured form of an error, so that C++ doesn't need to parse it back
+/// out of the error message. Functions that can fail with an error that C++
+/// maps to a specific exception type take one of these as an out parameter and
+/// fill it in before returning the error.
+#[derive(Clone, Debug)]
+pub struct ErrorDetails {
+    code: ErrorCode,
+    detail: String,
+    cycle: Vec<Vertex>,
+}
+
+pub fn new_error_details() -> Box<ErrorDetails> {
+    Box::new(ErrorDetails {
+        code: ErrorCode::Other,
+        detail: String::new(),
+        cycle: Vec::new(),
+    })
+}
+
+impl ErrorDetails {
+    /// Records the details of the given result's error, if it has one.
+    pub fn record<T, E: Into<VerboseError>>(
+        &mut self,
+        result: Result<T, E>,
+    ) -> Result<T, VerboseError> {
+        result.map_err(|e| {
+            let error = e.into();
+            self.set(&error);
+            error
+        })
+    }
+
+    fn set(&mut self, error: &VerboseError) {
+        let (code, detail, cycle) = match error {
+            VerboseError::CyclicInteractionError(cycle) => (
+                ErrorCode::CyclicInteraction,
+                fmt_cycle(cycle),
+                cycle.iter().cloned().map(Into::into).collect(),
+            ),
+            VerboseError::UndefinedGroupError(group) => {
+                (ErrorCode::UndefinedGroup, group.clone(), Vec::new())
+            }
+            VerboseError::PluginNotLoadedError(plugin) => {
+                (ErrorCode::PluginNotLoaded, plugin.clone(), Vec::new())
+            }
+            VerboseError::InvalidArgument(e) => (
+                ErrorCode::InvalidArgument,
+                ErrorChain(e.as_ref()).to_string(),
+                Vec::new(),
+            ),
+            VerboseError::Other(e) => (
+                ErrorCode::Other,
+                ErrorChain(e.as_ref()).to_string(),
+                Vec::new(),
+            ),
+        };
+
+        self.code = code;
+        self.detail = detail;
+        self.cycle = cycle;
+    }
+
+    pub fn code(&self) -> ErrorCode {
+        self.code
+    }
+
+    pub fn detail(&self) -> &str {
+        &self.detail
+    }
+
+    pub fn cycle(&self) -> &[Vertex] {
+        &self.cycle
+    }
+}
+
+fn fmt_cycle(cycle: &[libloot::Vertex]) -> String {
+    let mut output = String::new();
+    for vertex in cycle {
+        let name = vertex.name().replace('\\', "\\\\").replace('>', "\\>");
+        output.push_str(&name);
+        if let Some(e) = vertex.out_edge_type() {
+            output.push_str(" > ");
+            output.push_str(&e.to_string());
+            output.push_str(" > ");
+        }
+    }
+    output
+}
+
+struct ErrorChain<'a>(&'a dyn std::error::Error);
+
+impl std::fmt::Display for ErrorChain<'_> {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        fmt_error_chain(self.0, f)
+    }
+}
+
 variant_box_from_error!(UnsupportedEnumValueError, VerboseError::Other);
 variant_box_from_error!(NotValidUtf8, VerboseError::Other);
 variant_box_from_error!(DatabaseLockPoisonError, VerboseError::Other);
@@ -60,6 +151,7 @@ variant_box_from_error!(MetadataRetrievalError, VerboseError::Other);
 variant_box_from_error!(LoadOrderError, VerboseError::Other);
 variant_box_from_error!(LoadOrderStateError, VerboseError::Other);
 variant_box_from_error!(PluginDataError, VerboseError::Other);
+variant_box_from_error!(IoError, VerboseError::Other);
 
 impl From<GameHandleCreationError> for VerboseError {
     fn from(value: GameHandleCreationError) -> Self {
@@ -1,9 +1,11 @@
-use std::path::Path;
+use std::path::{Path, PathBuf};
 
 use delegate::delegate;
 use libloot_ffi_errors::UnsupportedEnumValueError;
 
-use crate::{OptionalPlugin, Plugin, VerboseError, database::Database, ffi::GameType};
+use crate::{
+    OptionalPlugin, Plugin, VerboseError, database::Database, error::ErrorDetails, ffi::GameType,
+};
 
 impl TryFrom<libloot::GameType> for GameType {
     type Error = UnsupportedEnumValueError;
@@ -77,24 +79,31 @@ impl std::error::Error for NotValidUtf8 {}
 pub struct Game(libloot::Game);
 
 // CXX doesn't support &Path so use &str instead.
-pub fn new_game(game_type: GameType, game_path: &str) -> Result<Box<Game>, VerboseError> {
-    libloot::Game::new(game_type.try_into()?, Path::new(game_path))
+pub fn new_game(
+    game_type: GameType,
+    game_path: &str,
+    error_details: &mut ErrorDetails,
+) -> Result<Box<Game>, VerboseError> {
+    let game_type = game_type.try_into()?;
+    error_details
+        .record(libloot::Game::new(game_type, Path::new(game_path)))
         .map(|g| Box::new(g.into()))
-        .map_err(Into::into)
 }
 
 pub fn new_game_with_local_path(
     game_type: GameType,
     game_path: &str,
     game_local_path: &str,
+    error_details: &mut ErrorDetails,
 ) -> Result<Box<Game>, VerboseError> {
-    libloot::Game::with_local_path(
-        game_type.try_into()?,
-        Path::new(game_path),
-        Path::new(game_local_path),
-    )
-    .map(|g| Box::new(g.into()))
-    .map_err(Into::into)
+    let game_type = game_type.try_into()?;
+    error_details
+        .record(libloot::Game::with_local_path(
+            game_type,
+            Path::new(game_path),
+            Path::new(game_local_path),
+        ))
+        .map(|g| Box::new(g.into()))
 }
 
 fn path_to_string(path: &Path) -> Result<String, VerboseError> {
@@ -137,22 +146,46 @@ impl Game {
         self.0.is_valid_plugin(Path::new(plugin_path))
     }
 
-    pub fn load_plugins(&mut self, plugin_paths: &[&str]) -> Result<(), VerboseError> {
-        self.0
-            .load_plugins(&strings_to_paths(plugin_paths))
-            .map_err(Into::into)
+    pub fn set_plugin_cache_directory(&mut self, cache_directory: &str) {
+        let cache_directory = if cache_directory.is_empty() {
+            None
+        } else {
+            Some(PathBuf::from(cache_directory))
+        };
+        self.0.set_plugin_cache_directory(cache_directory);
     }
 
-    pub fn load_plugin_headers(&mut self, plugin_paths: &[&str]) -> Result<(), VerboseError> {
-        self.0
-            .load_plugin_headers(&strings_to_paths(plugin_paths))
-            .map_err(Into::into)
+    pub fn save_plugin_cache(&mut self) -> Result<(), VerboseError> {
+        self.0.save_plugin_cache().map_err(Into::into)
+    }
+
+    pub fn load_plugins(
+        &mut self,
+        plugin_paths: &[&str],
+        error_details: &mut ErrorDetails,
+    ) -> Result<(), VerboseError> {
+        error_details.record(self.0.load_plugins(&strings_to_paths(plugin_paths)))
+    }
+
+    pub fn load_plugin_headers(
+        &mut self,
+        plugin_paths: &[&str],
+        error_details: &mut ErrorDetails,
+    ) -> Result<(), VerboseError> {
+        error_details.record(self.0.load_plugin_headers(&strings_to_paths(plugin_paths)))
     }
 
     pub fn plugin(&self, plugin_name: &str) -> Box<OptionalPlugin> {
         Box::new(self.0.plugin(plugin_name).map(Into::into).into())
     }
 
+    pub fn plugins(&self, plugin_names: &[&str]) -> Vec<OptionalPlugin> {
+        plugin_names
+            .iter()
+            .map(|n| self.0.plugin(n).map(Into::into).into())
+            .collect()
+    }
+
     pub fn loaded_plugins(&self) -> Vec<Plugin> {
         self.0
             .loaded_plugins()
@@ -161,8 +194,12 @@ impl Game {
             .collect()
     }
 
-    pub fn sort_plugins(&self, plugin_names: &[&str]) -> Result<Vec<String>, VerboseError> {
-        self.0.sort_plugins(plugin_names).map_err(Into::into)
+    pub fn sort_plugins(
+        &self,
+        plugin_names: &[&str],
+        error_details: &mut ErrorDetails,
+    ) -> Result<Vec<String>, VerboseError> {
+        error_details.record(self.0.sort_plugins(plugin_names))
     }
 
     pub fn load_current_load_order_state(&mut self) -> Result<(), VerboseError> {
@@ -191,8 +228,12 @@ impl Game {
 
     delegate! {
         to self.0 {
+            pub fn set_plugin_memory_mapping(&mut self, memory_map_plugins: bool);
+
             pub fn clear_loaded_plugins(&mut self);
 
+            pub fn set_sort_result_caching(&mut self, cache_sort_results: bool);
+
             pub fn is_plugin_active(&self, plugin_name: &str) -> bool;
         }
     }
@@ -16,19 +16,20 @@ mod metadata;
 mod plugin;
 
 use database::{Database, Vertex, new_vertex};
-use error::{EmptyOptionalError, VerboseError};
+use error::{EmptyOptionalError, ErrorDetails, VerboseError, new_error_details};
 use ffi::OptionalMessageContentRef;
 use game::{Game, new_game, new_game_with_local_path};
 use libloot_ffi_errors::UnsupportedEnumValueError;
 use metadata::{
     File, Filename, Group, Location, Message, MessageContent, PluginCleaningData, PluginMetadata,
-    Tag, group_default_name, message_content_default_language, multilingual_message, new_file,
-    new_filename, new_group, new_location, new_message, new_message_content,
-    new_plugin_cleaning_data, new_plugin_metadata, new_tag, select_message_content,
+    Tag, fold_filename_case, group_default_name, message_content_default_language,
+    multilingual_message, new_file, new_filename, new_group, new_location, new_message,
+    new_message_content, new_plugin_cleaning_data, new_plugin_metadata, new_tag,
+    select_message_content,
 };
 use plugin::Plugin;
 use std::{
-    ffi::{CString, c_char, c_uchar, c_uint, c_void},
+    ffi::{c_char, c_uchar, c_uint, c_void},
     sync::{Mutex, atomic::AtomicPtr},
 };
 
@@ -167,6 +168,14 @@ mod ffi {
         BlueprintMaster,
     }
 
+    pub enum ErrorCode {
+        Other,
+        CyclicInteraction,
+        UndefinedGroup,
+        PluginNotLoaded,
+        InvalidArgument,
+    }
+
     pub enum LogLevel {
         Trace,
         Debug,
@@ -203,12 +212,17 @@ mod ffi {
     extern "Rust" {
         type Game;
 
-        fn new_game(game_type: GameType, game_path: &str) -> Result<Box<Game>>;
+        fn new_game(
+            game_type: GameType,
+            game_path: &str,
+            error_details: &mut ErrorDetails,
+        ) -> Result<Box<Game>>;
 
         fn new_game_with_local_path(
             game_type: GameType,
             game_path: &str,
             game_local_path: &str,
+            error_details: &mut ErrorDetails,
         ) -> Result<Box<Game>>;
 
         pub fn game_type(&self) -> Result<GameType>;
@@ -221,17 +235,39 @@ mod ffi {
 
         pub fn is_valid_plugin(&self, plugin_path: &str) -> bool;
 
-        pub fn load_plugins(&mut self, plugin_paths: &[&str]) -> Result<()>;
+        pub fn set_plugin_memory_mapping(&mut self, memory_map_plugins: bool);
+
+        pub fn set_plugin_cache_directory(&mut self, cache_directory: &str);
 
-        pub fn load_plugin_headers(&mut self, plugin_paths: &[&str]) -> Result<()>;
+        pub fn save_plugin_cache(&mut self) -> Result<()>;
+
+        pub fn load_plugins(
+            &mut self,
+            plugin_paths: &[&str],
+            error_details: &mut ErrorDetails,
+        ) -> Result<()>;
+
+        pub fn load_plugin_headers(
+            &mut self,
+            plugin_paths: &[&str],
+            error_details: &mut ErrorDetails,
+        ) -> Result<()>;
 
         pub fn clear_loaded_plugins(&mut self);
 
         pub fn plugin(&self, plugin_name: &str) -> Box<OptionalPlugin>;
 
+        pub fn plugins(&self, plugin_names: &[&str]) -> Vec<OptionalPlugin>;
+
         pub fn loaded_plugins(&self) -> Vec<Plugin>;
 
-        pub fn sort_plugins(&self, plugin_names: &[&str]) -> Result<Vec<String>>;
+        pub fn set_sort_result_caching(&mut self, cache_sort_results: bool);
+
+        pub fn sort_plugins(
+            &self,
+            plugin_names: &[&str],
+            error_details: &mut ErrorDetails,
+        ) -> Result<Vec<String>>;
 
         pub fn load_current_load_order_state(&mut self) -> Result<()>;
 
@@ -279,6 +315,7 @@ mod ffi {
             &self,
             from_group_name: &str,
             to_group_name: &str,
+            error_details: &mut ErrorDetails,
         ) -> Result<Vec<Vertex>>;
 
         pub fn plugin_metadata(
@@ -288,6 +325,13 @@ mod ffi {
             evaluate_conditions: bool,
         ) -> Result<Box<OptionalPluginMetadata>>;
 
+        pub fn plugins_metadata(
+            &self,
+            plugin_names: &[&str],
+            include_user_metadata: bool,
+            evaluate_conditions: bool,
+        ) -> Result<Vec<OptionalPluginMetadata>>;
+
         pub fn plugin_user_metadata(
             &self,
             plugin_name: &str,
@@ -416,6 +460,18 @@ mod ffi {
         pub unsafe fn as_ref<'a>(&'a self) -> Result<&'a u32>;
     }
 
+    extern "Rust" {
+        type ErrorDetails;
+
+        pub fn new_error_details() -> Box<ErrorDetails>;
+
+        pub fn code(&self) -> ErrorCode;
+
+        pub fn detail(&self) -> &str;
+
+        pub fn cycle(&self) -> &[Vertex];
+    }
+
     extern "Rust" {
         type Vertex;
 
@@ -524,6 +580,8 @@ mod ffi {
 
         pub fn new_filename(name: String) -> Box<Filename>;
 
+        pub fn fold_filename_case(name: &str) -> String;
+
         pub fn as_str(&self) -> &str;
 
         pub fn boxed_clone(&self) -> Box<Filename>;
@@ -635,26 +693,14 @@ fn to_u8(value: libloot::LogLevel) -> u8 {
 
 #[unsafe(no_mangle)]
 unsafe extern "C" fn libloot_set_logging_callback(
-    callback: unsafe extern "C" fn(u8, *const c_char, *mut c_void),
+    callback: unsafe extern "C" fn(u8, *const c_char, usize, *mut c_void),
     context: *mut c_void,
 ) {
     let mutex = Mutex::new(AtomicPtr::new(context));
 
+    // The message is passed with its length instead of as a null-terminated
+    // string so that it doesn't need to be copied into a CString.
     set_logging_callback(move |level, message| {
-        let (level, c_string) = CString::new(message).map_or_else(
-            |_| {
-                let c_string = CString::new(format!(
-                    "Attempted to log a message containing a null byte: {}",
-                    message.replace('\0', "\\0")
-                ))
-                .unwrap_or_else(|_| {
-                    CString::from(c"Attempted to log a message containing a null byte")
-                });
-                (libloot::LogLevel::Error, c_string)
-            },
-            |c| (level, c),
-        );
-
         let mut context = match mutex.lock() {
             Ok(c) => c,
             Err(e) => {
@@ -666,7 +712,12 @@ unsafe extern "C" fn libloot_set_logging_callback(
 
         // SAFETY: This is safe so long as callback remains a valid function pointer.
         unsafe {
-            callback(to_u8(level), c_string.as_ptr(), *context.get_mut());
+            callback(
+                to_u8(level),
+                message.as_ptr().cast(),
+                message.len(),
+                *context.get_mut(),
+            );
         }
     });
 }
@@ -1,4 +1,5 @@
 use delegate::delegate;
+use unicase::UniCase;
 
 use crate::{
     UnsupportedEnumValueError, VerboseError,
@@ -454,6 +455,14 @@ pub fn new_filename(name: String) -> Box<Filename> {
     Box::new(Filename(libloot::metadata::Filename::new(name)))
 }
 
+/// Get the case-folded form of the given filename. Two filenames are equal if
+/// and only if their case-folded forms are byte-for-byte equal, and comparing
+/// case-folded forms bytewise gives the same ordering as comparing Filename
+/// values.
+pub fn fold_filename_case(name: &str) -> String {
+    UniCase::new(name).to_folded_case()
+}
+
 impl Filename {
     pub fn boxed_clone(&self) -> Box<Self> {
         Box::new(Self(self.0.clone()))
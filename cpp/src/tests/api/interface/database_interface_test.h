@@ -451,6 +451,29 @@ TEST_P(DatabaseInterfaceTest, getGroupsPathShouldThrowIfAGroupIsNotDefined) {
   }
 }
 
+TEST_P(DatabaseInterfaceTest,
+       errorsShouldBeMappedIndependentlyOfPreviouslyThrownErrors) {
+  auto& db = handle_->GetDatabase();
+
+  Group group1("group1", {"group2"});
+  Group group2("group2", {"group1"});
+  Group group3("group3", {"group4"});
+
+  db.SetUserGroups({group1, group2});
+  EXPECT_THROW(db.GetGroupsPath("group1", "group2"), CyclicInteractionError);
+
+  db.SetUserGroups({group3});
+  try {
+    db.GetGroupsPath("group3", "group4");
+    FAIL();
+  } catch (UndefinedGroupError& e) {
+    EXPECT_EQ("group4", e.GetGroupName());
+  }
+
+  db.SetUserGroups({group1, group2});
+  EXPECT_THROW(db.GetGroupsPath("group1", "group2"), CyclicInteractionError);
+}
+
 TEST_P(DatabaseInterfaceTest,
        getKnownBashTagsShouldReturnAllBashTagsListedInLoadedMetadata) {
   ASSERT_NO_THROW(GenerateMasterlist());
@@ -572,6 +595,135 @@ TEST_P(
   EXPECT_TRUE(metadata.GetMessages().empty());
 }
 
+TEST_P(DatabaseInterfaceTest,
+       getPluginMetadataBatchShouldReturnAnEmptyVectorIfGivenNoPlugins) {
+  EXPECT_TRUE(handle_->GetDatabase().GetPluginMetadataBatch({}).empty());
+}
+
+TEST_P(
+    DatabaseInterfaceTest,
+    getPluginMetadataBatchShouldReturnTheSameMetadataAsGetPluginMetadataInInputOrder) {
+  ASSERT_NO_THROW(GenerateMasterlist());
+  ASSERT_NO_THROW(GenerateUserlist());
+  ASSERT_NO_THROW(handle_->GetDatabase().LoadMasterlist(masterlistPath));
+  ASSERT_NO_THROW(handle_->GetDatabase().LoadUserlist(userlistPath_));
+
+  const std::vector<std::string_view> plugins{
+      blankDifferentEsm, blankEsm, missingEsp, blankEsm};
+
+  for (const auto evaluateConditions : {false, true}) {
+    const auto metadata = handle_->GetDatabase().GetPluginMetadataBatch(
+        plugins, true, evaluateConditions);
+
+    ASSERT_EQ(plugins.size(), metadata.size());
+    for (size_t i = 0; i < plugins.size(); ++i) {
+      const auto expected = handle_->GetDatabase().GetPluginMetadata(
+          plugins[i], true, evaluateConditions);
+
+      ASSERT_EQ(expected.has_value(), metadata[i].has_value());
+      if (expected.has_value()) {
+        EXPECT_EQ(expected->AsYaml(), metadata[i]->AsYaml());
+      }
+    }
+  }
+}
+
+TEST_P(
+    DatabaseInterfaceTest,
+    getPluginMetadataBatchShouldReturnOnlyValidMetadataIfConditionsAreEvaluated) {
+  ASSERT_NO_THROW(GenerateMasterlist());
+  ASSERT_NO_THROW(handle_->GetDatabase().LoadMasterlist(masterlistPath));
+
+  const auto metadata =
+      handle_->GetDatabase().GetPluginMetadataBatch({blankEsm}, false, true);
+
+  ASSERT_EQ(1, metadata.size());
+  ASSERT_TRUE(metadata[0].has_value());
+  EXPECT_TRUE(metadata[0]->GetMessages().empty());
+}
+
+TEST_P(
+    DatabaseInterfaceTest,
+    getPluginMetadataViewShouldReturnAnEmptyOptionalIfThePluginHasNoMetadata) {
+  EXPECT_FALSE(handle_->GetDatabase().GetPluginMetadataView(blankEsm));
+}
+
+TEST_P(DatabaseInterfaceTest,
+       getPluginMetadataViewShouldReturnTheSameDataAsGetPluginMetadata) {
+  ASSERT_NO_THROW(GenerateMasterlist());
+  ASSERT_NO_THROW(GenerateUserlist());
+  ASSERT_NO_THROW(handle_->GetDatabase().LoadMasterlist(masterlistPath));
+  ASSERT_NO_THROW(handle_->GetDatabase().LoadUserlist(userlistPath_));
+
+  const auto metadata =
+      handle_->GetDatabase().GetPluginMetadata(blankEsm, true).value();
+  const auto view =
+      handle_->GetDatabase().GetPluginMetadataView(blankEsm, true).value();
+
+  EXPECT_EQ(metadata.GetName(), view.GetName());
+  EXPECT_FALSE(view.GetGroup().has_value());
+  EXPECT_FALSE(view.HasNameOnly());
+  EXPECT_FALSE(view.IsRegexPlugin());
+
+  const auto loadAfter = metadata.GetLoadAfterFiles();
+  ASSERT_EQ(loadAfter.size(), view.GetLoadAfterFiles().size());
+  for (size_t i = 0; i < loadAfter.size(); ++i) {
+    EXPECT_EQ(std::string(loadAfter[i].GetName()),
+              view.GetLoadAfterFiles()[i].GetName());
+  }
+
+  const auto tags = metadata.GetTags();
+  ASSERT_EQ(tags.size(), view.GetTags().size());
+  size_t i = 0;
+  for (const auto tag : view.GetTags()) {
+    EXPECT_EQ(tags[i].GetName(), tag.GetName());
+    EXPECT_EQ(tags[i].IsAddition(), tag.IsAddition());
+    EXPECT_EQ(tags[i].GetCondition(), tag.GetCondition());
+    ++i;
+  }
+
+  const auto messages = metadata.GetMessages();
+  ASSERT_EQ(messages.size(), view.GetMessages().size());
+  const auto message = view.GetMessages()[0];
+  EXPECT_EQ(messages[0].GetType(), message.GetType());
+  EXPECT_EQ(messages[0].GetCondition(), message.GetCondition());
+  ASSERT_EQ(1, message.GetContent().size());
+  EXPECT_EQ(messages[0].GetContent()[0].GetText(),
+            message.GetContent()[0].GetText());
+}
+
+TEST_P(DatabaseInterfaceTest,
+       getPluginMetadataViewShouldRemainValidAfterTheDatabaseIsChanged) {
+  ASSERT_NO_THROW(GenerateMasterlist());
+  ASSERT_NO_THROW(handle_->GetDatabase().LoadMasterlist(masterlistPath));
+
+  const auto view =
+      handle_->GetDatabase().GetPluginMetadataView(blankDifferentEsm).value();
+
+  handle_->GetDatabase().DiscardAllUserMetadata();
+  ASSERT_NO_THROW(handle_->GetDatabase().LoadMasterlist(masterlistPath));
+
+  ASSERT_EQ(1, view.GetDirtyInfo().size());
+  EXPECT_EQ(0x7D22F9DF, view.GetDirtyInfo()[0].GetCRC());
+  EXPECT_EQ("TES4Edit", view.GetDirtyInfo()[0].GetCleaningUtility());
+  EXPECT_EQ(4, view.GetDirtyInfo()[0].GetDeletedReferenceCount());
+}
+
+TEST_P(DatabaseInterfaceTest,
+       pluginMetadataViewListsShouldRemainValidAfterTheViewIsDestroyed) {
+  ASSERT_NO_THROW(GenerateMasterlist());
+  ASSERT_NO_THROW(handle_->GetDatabase().LoadMasterlist(masterlistPath));
+
+  auto view = handle_->GetDatabase().GetPluginMetadataView(blankDifferentEsm);
+  ASSERT_TRUE(view.has_value());
+  const auto dirtyInfo = view->GetDirtyInfo();
+  view.reset();
+
+  ASSERT_EQ(1, dirtyInfo.size());
+  EXPECT_EQ(0x7D22F9DF, dirtyInfo[0].GetCRC());
+  EXPECT_EQ("TES4Edit", dirtyInfo[0].GetCleaningUtility());
+}
+
 TEST_P(
     DatabaseInterfaceTest,
     getPluginUserMetadataShouldReturnAnEmptyPluginMetadataObjectIfThePluginHasNoUserMetadata) {
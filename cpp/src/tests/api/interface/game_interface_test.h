@@ -25,6 +25,8 @@ along with LOOT.  If not, see
 #ifndef LOOT_TESTS_API_INTERFACE_GAME_INTERFACE_TEST
 #define LOOT_TESTS_API_INTERFACE_GAME_INTERFACE_TEST
 
+#include <thread>
+
 #include "loot/api.h"
 #include "tests/api/interface/api_game_operations_test.h"
 
@@ -262,6 +264,42 @@ TEST_P(GameInterfaceTest,
   EXPECT_EQ(blankEsmCrc, plugin->GetCRC().value());
 }
 
+TEST_P(GameInterfaceTest,
+       loadPluginsWithMemoryMappingShouldFullyLoadAllInstalledPlugins) {
+  handle_->SetPluginMemoryMapping(true);
+  handle_->LoadPlugins(pluginsToLoad, false);
+
+  if (GetParam() == GameType::starfield) {
+    EXPECT_EQ(6, handle_->GetLoadedPlugins().size());
+  } else {
+    EXPECT_EQ(11, handle_->GetLoadedPlugins().size());
+  }
+
+  auto plugin = handle_->GetPlugin(masterFile);
+  ASSERT_NE(nullptr, plugin);
+  EXPECT_EQ("5.0", plugin->GetVersion().value());
+  EXPECT_EQ(blankEsmCrc, plugin->GetCRC().value());
+}
+
+TEST_P(GameInterfaceTest,
+       savePluginCacheShouldCacheCalculatedPluginCrcs) {
+  const auto cacheDirectory = localPath / "cache";
+  handle_->SetPluginCacheDirectory(cacheDirectory);
+  handle_->LoadPlugins(pluginsToLoad, false);
+
+  auto plugin = handle_->GetPlugin(masterFile);
+  ASSERT_NE(nullptr, plugin);
+  EXPECT_EQ(blankEsmCrc, plugin->GetCRC().value());
+
+  handle_->ClearLoadedPlugins();
+
+  EXPECT_FALSE(std::filesystem::exists(cacheDirectory / "plugin-crcs.txt"));
+
+  handle_->SavePluginCache();
+
+  EXPECT_TRUE(std::filesystem::exists(cacheDirectory / "plugin-crcs.txt"));
+}
+
 TEST_P(GameInterfaceTest, loadPluginsWithANonAsciiPluginShouldLoadIt) {
   handle_->LoadPlugins({std::filesystem::u8path(nonAsciiEsm)}, false);
   EXPECT_EQ(1, handle_->GetLoadedPlugins().size());
@@ -470,6 +508,24 @@ TEST_P(GameInterfaceTest,
   }
 }
 
+TEST_P(GameInterfaceTest,
+       sortPluginsWithResultCachingShouldNotReuseResultsAfterMetadataChanges) {
+  handle_->LoadPlugins(GetInstalledPlugins(), false);
+  handle_->SetSortResultCaching(true);
+
+  std::vector<std::string> plugins{blankEsp, blankDifferentEsp};
+  EXPECT_EQ(plugins, handle_->SortPlugins(plugins));
+  EXPECT_EQ(plugins, handle_->SortPlugins(plugins));
+
+  PluginMetadata blankEspMetadata(blankEsp);
+  blankEspMetadata.SetLoadAfterFiles({File(blankDifferentEsp)});
+  handle_->GetDatabase().SetPluginUserMetadata(blankEspMetadata);
+
+  const std::vector<std::string> expectedSortedOrder{blankDifferentEsp,
+                                                     blankEsp};
+  EXPECT_EQ(expectedSortedOrder, handle_->SortPlugins(plugins));
+}
+
 TEST_P(GameInterfaceTest, sortPluginsShouldThrowIfAGivenPluginIsNotLoaded) {
   std::vector<std::string> plugins{blankEsp, blankDifferentEsp};
 
@@ -521,6 +577,76 @@ TEST_P(GameInterfaceTest, getPluginThatIsNotCachedShouldReturnANullPointer) {
   EXPECT_FALSE(handle_->GetPlugin(blankEsm));
 }
 
+TEST_P(GameInterfaceTest,
+       getPluginsShouldReturnPointersInInputOrderWithNullsForUnloadedPlugins) {
+  handle_->LoadPlugins({std::filesystem::u8path(blankEsm),
+                        std::filesystem::u8path(blankEsp)},
+                       true);
+
+  const auto plugins = handle_->GetPlugins({blankEsp, "missing.esp", blankEsm});
+
+  ASSERT_EQ(3, plugins.size());
+  ASSERT_NE(nullptr, plugins[0]);
+  EXPECT_EQ(blankEsp, plugins[0]->GetName());
+  EXPECT_EQ(nullptr, plugins[1]);
+  ASSERT_NE(nullptr, plugins[2]);
+  EXPECT_EQ(blankEsm, plugins[2]->GetName());
+}
+
+TEST_P(GameInterfaceTest, getPluginsShouldShareCachedPointersWithGetPlugin) {
+  handle_->LoadPlugins({std::filesystem::u8path(blankEsm),
+                        std::filesystem::u8path(blankEsp)},
+                       true);
+  const auto pointer = handle_->GetPlugin(blankEsm);
+  ASSERT_NE(nullptr, pointer);
+
+  const auto plugins = handle_->GetPlugins({blankEsm, blankEsp});
+
+  ASSERT_EQ(2, plugins.size());
+  EXPECT_EQ(pointer, plugins[0]);
+  EXPECT_EQ(plugins[1], handle_->GetPlugin(blankEsp));
+}
+
+TEST_P(GameInterfaceTest, getPluginsShouldReturnAnEmptyVectorIfGivenNoNames) {
+  EXPECT_TRUE(handle_->GetPlugins({}).empty());
+}
+
+TEST_P(GameInterfaceTest,
+       getPluginShouldReturnTheSamePointerWhenCalledFromMultipleThreads) {
+  handle_->LoadPlugins({std::filesystem::u8path(blankEsm)}, true);
+
+  std::vector<std::shared_ptr<const PluginInterface>> pointers(4);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < pointers.size(); ++i) {
+    threads.emplace_back(
+        [&, i]() { pointers[i] = handle_->GetPlugin(blankEsm); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_NE(nullptr, pointers[0]);
+  for (const auto& pointer : pointers) {
+    EXPECT_EQ(pointers[0], pointer);
+  }
+}
+
+TEST_P(GameInterfaceTest,
+       getLoadedPluginsShouldReturnThePointersThatGetPluginReturns) {
+  handle_->LoadPlugins({std::filesystem::u8path(blankEsm),
+                        std::filesystem::u8path(blankEsp)},
+                       true);
+  const auto pointer = handle_->GetPlugin(blankEsp);
+  ASSERT_NE(nullptr, pointer);
+
+  const auto plugins = handle_->GetLoadedPlugins();
+
+  ASSERT_EQ(2, plugins.size());
+  EXPECT_NE(plugins.end(), std::find(plugins.begin(), plugins.end(), pointer));
+  EXPECT_EQ(handle_->GetPlugin(blankEsm),
+            plugins[0] == pointer ? plugins[1] : plugins[0]);
+}
+
 TEST_P(GameInterfaceTest,
        gettingPluginsShouldReturnAnEmptySetIfNoneHaveBeenLoaded) {
   EXPECT_TRUE(handle_->GetLoadedPlugins().empty());
@@ -50,6 +50,18 @@ TEST(File, stringsConstructorShouldStoreGivenStrings) {
   EXPECT_EQ("constraint", file.GetConstraint());
 }
 
+TEST(File, refGettersShouldReferenceTheStoredData) {
+  std::vector<MessageContent> detail = {MessageContent("text", "en")};
+  File file("name", "display", "condition", detail, "constraint");
+
+  EXPECT_EQ(file.GetName(), file.GetNameRef());
+  EXPECT_EQ("display", file.GetDisplayNameRef());
+  EXPECT_EQ("condition", file.GetConditionRef());
+  EXPECT_EQ(detail, file.GetDetailRef());
+  EXPECT_EQ("constraint", file.GetConstraintRef());
+  EXPECT_EQ(&file.GetDetailRef(), &file.GetDetailRef());
+}
+
 TEST(File, equalityShouldBeCaseInsensitiveOnName) {
   File file1("name", "display", "condition");
   File file2("name", "display", "condition");
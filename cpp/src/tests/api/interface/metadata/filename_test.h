@@ -0,0 +1,114 @@
+/*  LOOT
+
+A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+Fallout: New Vegas.
+
+Copyright (C) 2025    WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_TESTS_API_INTERFACE_METADATA_FILENAME_TEST
+#define LOOT_TESTS_API_INTERFACE_METADATA_FILENAME_TEST
+
+#include <gtest/gtest.h>
+
+#include <unordered_set>
+
+#include "loot/metadata/filename.h"
+
+namespace loot::test {
+TEST(Filename, defaultConstructorShouldSetEmptyString) {
+  Filename filename;
+
+  EXPECT_EQ("", std::string(filename));
+}
+
+TEST(Filename, stringConstructorShouldPreserveTheGivenString) {
+  Filename filename("Blank.esm");
+
+  EXPECT_EQ("Blank.esm", std::string(filename));
+}
+
+TEST(Filename, equalityShouldBeCaseInsensitive) {
+  EXPECT_TRUE(Filename("Blank.esm") == Filename("bLANK.ESM"));
+  EXPECT_FALSE(Filename("Blank.esm") == Filename("Blank.esp"));
+}
+
+TEST(Filename, equalityShouldUseUnicodeCaseFolding) {
+  EXPECT_TRUE(Filename(u8"\u00C9ditions.esp") ==
+              Filename(u8"\u00E9ditions.esp"));
+  EXPECT_TRUE(Filename(u8"Stra\u00DFe.esp") == Filename("STRASSE.esp"));
+  EXPECT_TRUE(Filename(u8"\u212A.esp") == Filename("k.esp"));
+  EXPECT_FALSE(Filename(u8"\u00E9ditions.esp") == Filename("editions.esp"));
+}
+
+TEST(Filename, inequalityShouldBeTheInverseOfEquality) {
+  EXPECT_FALSE(Filename("Blank.esm") != Filename("bLANK.ESM"));
+  EXPECT_TRUE(Filename("Blank.esm") != Filename("Blank.esp"));
+}
+
+TEST(Filename, lessThanOperatorShouldBeCaseInsensitive) {
+  EXPECT_TRUE(Filename("a.esp") < Filename("B.esp"));
+  EXPECT_FALSE(Filename("B.esp") < Filename("a.esp"));
+  EXPECT_FALSE(Filename("A.esp") < Filename("a.esp"));
+  EXPECT_FALSE(Filename("a.esp") < Filename("A.esp"));
+}
+
+TEST(Filename, lessThanOperatorShouldCompareCaseFoldedCodePoints) {
+  EXPECT_TRUE(Filename("z.esp") < Filename(u8"\u00C9.esp"));
+  EXPECT_FALSE(Filename(u8"\u00C9.esp") < Filename("z.esp"));
+  EXPECT_TRUE(Filename("STRASSE.esp") < Filename(u8"Stra\u00DFf.esp"));
+}
+
+TEST(Filename, greaterThanOperatorShouldBeTheInverseOfLessThan) {
+  EXPECT_TRUE(Filename("B.esp") > Filename("a.esp"));
+  EXPECT_FALSE(Filename("a.esp") > Filename("B.esp"));
+  EXPECT_FALSE(Filename("A.esp") > Filename("a.esp"));
+}
+
+TEST(Filename, lessThanOrEqualOperatorShouldReturnTrueForEqualFilenames) {
+  EXPECT_TRUE(Filename("A.esp") <= Filename("a.esp"));
+  EXPECT_TRUE(Filename("a.esp") <= Filename("B.esp"));
+  EXPECT_FALSE(Filename("B.esp") <= Filename("a.esp"));
+}
+
+TEST(Filename, greaterThanOrEqualOperatorShouldReturnTrueForEqualFilenames) {
+  EXPECT_TRUE(Filename("A.esp") >= Filename("a.esp"));
+  EXPECT_TRUE(Filename("B.esp") >= Filename("a.esp"));
+  EXPECT_FALSE(Filename("a.esp") >= Filename("B.esp"));
+}
+
+TEST(Filename, hashShouldBeEqualForCaseInsensitivelyEqualFilenames) {
+  std::hash<Filename> hasher;
+
+  EXPECT_EQ(hasher(Filename("Blank.esm")), hasher(Filename("bLANK.ESM")));
+  EXPECT_EQ(hasher(Filename(u8"Stra\u00DFe.esp")),
+            hasher(Filename("STRASSE.esp")));
+}
+
+TEST(Filename, shouldBeUsableAsAnUnorderedSetKey) {
+  std::unordered_set<Filename> filenames{Filename("Blank.esm"),
+                                         Filename("Blank.esp")};
+
+  EXPECT_EQ(1, filenames.count(Filename("blank.esm")));
+  EXPECT_EQ(1, filenames.count(Filename("BLANK.ESP")));
+  EXPECT_EQ(0, filenames.count(Filename("Blank.esl")));
+}
+}
+
+#endif
@@ -54,6 +54,15 @@ TEST(Group, allArgsConstructorShouldStoreGivenValues) {
   EXPECT_EQ(std::vector<std::string>({"other_group"}), group.GetAfterGroups());
 }
 
+TEST(Group, refGettersShouldReferenceTheStoredValues) {
+  Group group("group1", {"other_group"}, "test");
+
+  EXPECT_EQ("group1", group.GetNameRef());
+  EXPECT_EQ("test", group.GetDescriptionRef());
+  EXPECT_EQ(std::vector<std::string>({"other_group"}),
+            group.GetAfterGroupsRef());
+}
+
 TEST(Group, equalityShouldBeCaseSensitiveOnNameAndDescription) {
   Group group1("name", {}, "description");
   Group group2("name", {}, "description");
@@ -44,6 +44,13 @@ TEST(Location, stringsConstructorShouldStoreGivenStrings) {
   EXPECT_EQ("example", location.GetName());
 }
 
+TEST(Location, refGettersShouldReferenceTheStoredStrings) {
+  Location location("http://www.example.com", "example");
+
+  EXPECT_EQ("http://www.example.com", location.GetURLRef());
+  EXPECT_EQ("example", location.GetNameRef());
+}
+
 TEST(Location, equalityShouldBeCaseSensitiveOnUrlAndName) {
   Location location1("http://www.example.com", "example");
   Location location2("http://www.example.com", "example");
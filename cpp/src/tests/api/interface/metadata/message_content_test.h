@@ -46,6 +46,14 @@ TEST(MessageContent, contentConstructorShouldStoreGivenStringAndLanguage) {
   EXPECT_EQ(french, content.GetLanguage());
 }
 
+TEST(MessageContent, refGettersShouldReferenceTheStoredStringAndLanguage) {
+  MessageContent content("content", french);
+
+  EXPECT_EQ("content", content.GetTextRef());
+  EXPECT_EQ(french, content.GetLanguageRef());
+  EXPECT_EQ(&content.GetTextRef(), &content.GetTextRef());
+}
+
 TEST(MessageContent,
      equalityShouldRequireCaseSensitiveEqualityOnTextAndLanguage) {
   MessageContent content1("content", "fr");
@@ -64,6 +64,18 @@ TEST_F(MessageTest,
   EXPECT_EQ("condition1", message.GetCondition());
 }
 
+TEST_F(MessageTest, refGettersShouldReferenceTheStoredContentAndCondition) {
+  MessageContents contents({
+      MessageContent("content1"),
+      MessageContent("content2", french),
+  });
+  Message message(MessageType::error, contents, "condition1");
+
+  EXPECT_EQ(contents, message.GetContentRef());
+  EXPECT_EQ("condition1", message.GetConditionRef());
+  EXPECT_EQ(&message.GetContentRef(), &message.GetContentRef());
+}
+
 TEST_F(
     MessageTest,
     vectorContentConstructorShouldThrowIfMultipleContentStringsAreGivenAndNoneAreEnglish) {
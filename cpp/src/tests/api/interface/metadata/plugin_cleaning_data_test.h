@@ -61,6 +61,14 @@ TEST_F(PluginCleaningDataTest, contentConstructorShouldStoreAllGivenData) {
   EXPECT_EQ(info_, info.GetDetail());
 }
 
+TEST_F(PluginCleaningDataTest,
+       refGettersShouldReferenceTheStoredUtilityAndDetail) {
+  PluginCleaningData info(0x12345678, "cleaner", info_, 2, 10, 30);
+
+  EXPECT_EQ("cleaner", info.GetCleaningUtilityRef());
+  EXPECT_EQ(info_, info.GetDetailRef());
+}
+
 TEST_F(PluginCleaningDataTest, equalityShouldCheckEqualityOfAllFields) {
   PluginCleaningData info1(0x12345678, "cleaner", info_, 2, 10, 30);
   PluginCleaningData info2(0x12345678, "cleaner", info_, 2, 10, 30);
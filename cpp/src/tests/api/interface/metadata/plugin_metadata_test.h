@@ -243,6 +243,59 @@ TEST_F(PluginMetadataTest, mergeMetadataShouldMergeLocationData) {
             plugin1.GetLocations());
 }
 
+TEST_F(PluginMetadataTest, refGettersShouldReferenceTheStoredMetadata) {
+  PluginMetadata plugin(blankEsm);
+  const std::vector<File> files({File(blankDifferentEsm)});
+  const std::vector<Message> messages({Message(MessageType::say, "content")});
+  const std::vector<Tag> tags({Tag("Relev")});
+  const std::vector<PluginCleaningData> info(
+      {PluginCleaningData(0x12345678, "cleaner", info_, 2, 10, 30)});
+  const std::vector<Location> locations({Location("http://www.example.com")});
+
+  plugin.SetGroup("group1");
+  plugin.SetLoadAfterFiles(files);
+  plugin.SetRequirements(files);
+  plugin.SetIncompatibilities(files);
+  plugin.SetMessages(messages);
+  plugin.SetTags(tags);
+  plugin.SetDirtyInfo(info);
+  plugin.SetCleanInfo(info);
+  plugin.SetLocations(locations);
+
+  EXPECT_EQ(blankEsm, plugin.GetNameRef());
+  EXPECT_EQ("group1", plugin.GetGroupRef());
+  EXPECT_EQ(files, plugin.GetLoadAfterFilesRef());
+  EXPECT_EQ(files, plugin.GetRequirementsRef());
+  EXPECT_EQ(files, plugin.GetIncompatibilitiesRef());
+  EXPECT_EQ(messages, plugin.GetMessagesRef());
+  EXPECT_EQ(tags, plugin.GetTagsRef());
+  EXPECT_EQ(info, plugin.GetDirtyInfoRef());
+  EXPECT_EQ(info, plugin.GetCleanInfoRef());
+  EXPECT_EQ(locations, plugin.GetLocationsRef());
+  EXPECT_EQ(&plugin.GetTagsRef(), &plugin.GetTagsRef());
+}
+
+TEST_F(PluginMetadataTest, settersShouldAcceptVectorsToMoveFrom) {
+  PluginMetadata plugin(blankEsm);
+  std::vector<File> files({File(blankDifferentEsm)});
+  std::vector<Tag> tags({Tag("Relev")});
+  std::vector<Location> locations({Location("http://www.example.com")});
+  const auto expectedFiles = files;
+  const auto expectedTags = tags;
+  const auto expectedLocations = locations;
+
+  plugin.SetLoadAfterFiles(std::move(files));
+  plugin.SetTags(std::move(tags));
+  plugin.SetLocations(std::move(locations));
+  plugin.SetMessages({Message(MessageType::say, "content")});
+
+  EXPECT_EQ(expectedFiles, plugin.GetLoadAfterFilesRef());
+  EXPECT_EQ(expectedTags, plugin.GetTagsRef());
+  EXPECT_EQ(expectedLocations, plugin.GetLocationsRef());
+  EXPECT_EQ(std::vector<Message>({Message(MessageType::say, "content")}),
+            plugin.GetMessagesRef());
+}
+
 TEST_F(PluginMetadataTest, unsetGroupShouldLeaveNoGroupValueSet) {
   PluginMetadata plugin;
   EXPECT_FALSE(plugin.GetGroup().has_value());
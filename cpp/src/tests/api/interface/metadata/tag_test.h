@@ -47,6 +47,13 @@ TEST(Tag, dataConstructorShouldSetFieldsToGivenValues) {
   EXPECT_EQ("condition", tag.GetCondition());
 }
 
+TEST(Tag, refGettersShouldReferenceTheStoredNameAndCondition) {
+  Tag tag("name", false, "condition");
+
+  EXPECT_EQ("name", tag.GetNameRef());
+  EXPECT_EQ("condition", tag.GetConditionRef());
+}
+
 TEST(Tag, equalityShouldBeCaseSensitiveOnNameAndCondition) {
   Tag tag1("name", true, "condition");
   Tag tag2("name", true, "condition");
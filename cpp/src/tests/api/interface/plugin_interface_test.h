@@ -25,6 +25,8 @@ along with LOOT.  If not, see
 #ifndef LOOT_TESTS_API_INTERFACE_PLUGIN_INTERFACE_TEST
 #define LOOT_TESTS_API_INTERFACE_PLUGIN_INTERFACE_TEST
 
+#include <thread>
+
 #include "loot/api.h"
 #include "tests/api/interface/api_game_operations_test.h"
 
@@ -135,6 +137,8 @@ class TestPlugin : public PluginInterface {
 public:
   std::string GetName() const override { return ""; }
 
+  const std::string& GetNameRef() const override { return name_; }
+
   std::optional<float> GetHeaderVersion() const override {
     return std::optional<float>();
   }
@@ -143,10 +147,22 @@ public:
     return std::optional<std::string>();
   }
 
+  const std::optional<std::string>& GetVersionRef() const override {
+    return version_;
+  }
+
   std::vector<std::string> GetMasters() const override { return {}; }
 
+  const std::vector<std::string>& GetMastersRef() const override {
+    return strings_;
+  }
+
   std::vector<std::string> GetBashTags() const override { return {}; }
 
+  const std::vector<std::string>& GetBashTagsRef() const override {
+    return strings_;
+  }
+
   std::optional<uint32_t> GetCRC() const override {
     return std::optional<uint32_t>();
   }
@@ -172,6 +188,11 @@ public:
   bool LoadsArchive() const override { return false; }
 
   bool DoRecordsOverlap(const PluginInterface&) const override { return false; }
+
+private:
+  std::string name_;
+  std::optional<std::string> version_;
+  std::vector<std::string> strings_;
 };
 
 // Pass an empty first argument, as it's a prefix for the test instantation,
@@ -242,6 +263,35 @@ TEST_P(PluginInterfaceTest,
   EXPECT_FALSE(plugin->IsMaster());
 }
 
+TEST_P(PluginInterfaceTest, refGettersShouldReturnTheSameDataAsValueGetters) {
+  const auto plugin = LoadPluginHeader(blankMasterDependentEsp);
+
+  EXPECT_EQ(plugin->GetName(), plugin->GetNameRef());
+  EXPECT_EQ(plugin->GetVersion(), plugin->GetVersionRef());
+  EXPECT_EQ(plugin->GetMasters(), plugin->GetMastersRef());
+  EXPECT_EQ(plugin->GetBashTags(), plugin->GetBashTagsRef());
+}
+
+TEST_P(PluginInterfaceTest,
+       refGettersShouldReturnTheSameReferenceWhenCalledConcurrently) {
+  const auto plugin = LoadPluginHeader(blankMasterDependentEsp);
+
+  std::vector<const std::vector<std::string>*> masters(4, nullptr);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < masters.size(); ++i) {
+    threads.emplace_back(
+        [&plugin, &masters, i]() { masters[i] = &plugin->GetMastersRef(); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto pointer : masters) {
+    EXPECT_EQ(masters[0], pointer);
+  }
+  EXPECT_EQ(&plugin->GetNameRef(), &plugin->GetNameRef());
+}
+
 TEST_P(
     PluginInterfaceTest,
     isLightPluginShouldBeTrueForAPluginWithEslFileExtensionForFallout4AndSkyrimSe) {
@@ -7,12 +7,13 @@ mod parse;
 use std::collections::{BTreeMap, BTreeSet};
 
 pub(crate) use find::find_associated_archives;
-pub(crate) use parse::assets_in_archives;
+pub(crate) use parse::{assets_in_archive, assets_in_archives};
 
-pub(crate) fn do_assets_overlap(
-    assets: &BTreeMap<u64, BTreeSet<u64>>,
-    other_assets: &BTreeMap<u64, BTreeSet<u64>>,
-) -> bool {
+/// The hashes of the files in an archive, grouped by the hashes of the folders
+/// that they are in.
+pub(crate) type ArchiveAssets = BTreeMap<u64, BTreeSet<u64>>;
+
+pub(crate) fn do_assets_overlap(assets: &ArchiveAssets, other_assets: &ArchiveAssets) -> bool {
     let mut assets_iter = assets.iter();
     let mut other_assets_iter = other_assets.iter();
 
@@ -44,11 +45,12 @@ mod tests {
         use std::path::PathBuf;
 
         use super::*;
+        use crate::game::GameCache;
 
         #[test]
         fn should_return_true_if_the_same_file_exists_in_the_same_folder() {
             let path = PathBuf::from("./testing-plugins/Oblivion/Data/Blank.bsa");
-            let assets = assets_in_archives(&[path]);
+            let assets = assets_in_archives(&[path], &GameCache::default());
 
             assert!(do_assets_overlap(&assets, &assets));
         }
@@ -56,10 +58,10 @@ mod tests {
         #[test]
         fn should_return_false_if_the_same_file_exists_in_different_folders() {
             let path = PathBuf::from("./testing-plugins/Oblivion/Data/Blank.bsa");
-            let assets1 = assets_in_archives(&[path]);
+            let assets1 = assets_in_archives(&[path], &GameCache::default());
 
             let path = PathBuf::from("./testing-plugins/Skyrim/Data/Blank.bsa");
-            let assets2 = assets_in_archives(&[path]);
+            let assets2 = assets_in_archives(&[path], &GameCache::default());
 
             assert_eq!(assets1.get(&0), assets2.get(&0x2E01_002E));
 
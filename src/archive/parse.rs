@@ -3,45 +3,47 @@ use std::{
     fs::File,
     io::{BufReader, Read},
     path::{Path, PathBuf},
+    sync::Arc,
 };
 
-use super::error::{ArchiveParsingError, ArchivePathParsingError};
+use super::{
+    ArchiveAssets,
+    error::{ArchiveParsingError, ArchivePathParsingError},
+};
 use crate::{
     escape_ascii,
+    game::GameCache,
     logging::{self, format_details},
     plugin::has_ascii_extension,
 };
 
 use super::{ba2, bsa};
 
-pub(crate) fn assets_in_archives(archive_paths: &[PathBuf]) -> BTreeMap<u64, BTreeSet<u64>> {
-    let mut archive_assets: BTreeMap<u64, BTreeSet<u64>> = BTreeMap::new();
+/// Get the assets in the given archives, merged into a single map of folder
+/// hashes to file hashes.
+///
+/// The assets of archives that are in the given game cache's archive index are
+/// taken from it, and any other archives are parsed. If there is only one
+/// archive, its assets are shared instead of copied.
+pub(crate) fn assets_in_archives(
+    archive_paths: &[PathBuf],
+    game_cache: &GameCache,
+) -> Arc<ArchiveAssets> {
+    if let [archive_path] = archive_paths {
+        return cached_or_parsed_assets(archive_path, game_cache);
+    }
 
-    for archive_path in archive_paths {
-        logging::trace!(
-            "Getting assets loaded from the Bethesda archive at \"{}\"",
-            escape_ascii(archive_path)
-        );
-
-        let assets = match get_assets_in_archive(archive_path) {
-            Ok(a) => a,
-            Err(e) => {
-                logging::error!(
-                    "Encountered an error while trying to read the Bethesda archive at \"{}\": {}",
-                    escape_ascii(archive_path),
-                    format_details(&e)
-                );
-                continue;
-            }
-        };
+    let mut merged_assets = ArchiveAssets::new();
 
+    for archive_path in archive_paths {
+        let assets = cached_or_parsed_assets(archive_path, game_cache);
         let warn_on_hash_collisions = should_warn_on_hash_collisions(archive_path);
 
-        for (folder_hash, file_hashes) in assets {
-            let entry_file_hashes = archive_assets.entry(folder_hash).or_default();
+        for (folder_hash, file_hashes) in &*assets {
+            let entry_file_hashes = merged_assets.entry(*folder_hash).or_default();
 
             for file_hash in file_hashes {
-                if !entry_file_hashes.insert(file_hash) && warn_on_hash_collisions {
+                if !entry_file_hashes.insert(*file_hash) && warn_on_hash_collisions {
                     logging::warn!(
                         "The folder and file with hashes {:x} and {:x} in \"{}\" are present in another Bethesda archive.",
                         folder_hash,
@@ -53,7 +55,34 @@ pub(crate) fn assets_in_archives(archive_paths: &[PathBuf]) -> BTreeMap<u64, BTr
         }
     }
 
-    archive_assets
+    Arc::new(merged_assets)
+}
+
+fn cached_or_parsed_assets(archive_path: &Path, game_cache: &GameCache) -> Arc<ArchiveAssets> {
+    game_cache
+        .archive_assets(archive_path)
+        .unwrap_or_else(|| Arc::new(assets_in_archive(archive_path)))
+}
+
+/// Get the assets in the given archive. If the archive can't be read, the
+/// error is logged and no assets are returned.
+pub(crate) fn assets_in_archive(archive_path: &Path) -> ArchiveAssets {
+    logging::trace!(
+        "Getting assets loaded from the Bethesda archive at \"{}\"",
+        escape_ascii(archive_path)
+    );
+
+    match get_assets_in_archive(archive_path) {
+        Ok(a) => a,
+        Err(e) => {
+            logging::error!(
+                "Encountered an error while trying to read the Bethesda archive at \"{}\": {}",
+                escape_ascii(archive_path),
+                format_details(&e)
+            );
+            ArchiveAssets::new()
+        }
+    }
 }
 
 fn should_warn_on_hash_collisions(archive_path: &Path) -> bool {
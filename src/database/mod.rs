@@ -4,6 +4,7 @@ mod error;
 use std::{collections::HashMap, path::Path};
 
 use conditions::{evaluate_all_conditions, evaluate_condition, filter_map_on_condition};
+use rayon::iter::{IntoParallelRefIterator, ParallelIterator};
 
 use crate::{
     logging,
@@ -57,6 +58,10 @@ pub struct Database {
     masterlist: MetadataDocument,
     userlist: MetadataDocument,
     condition_evaluator_state: loot_condition_interpreter::State,
+    /// Incremented whenever anything that could affect the metadata that the
+    /// database gives changes, so that results derived from that metadata can
+    /// be cached until it's changed.
+    revision: u64,
 }
 
 impl Database {
@@ -66,16 +71,27 @@ impl Database {
             masterlist: MetadataDocument::default(),
             userlist: MetadataDocument::default(),
             condition_evaluator_state,
+            revision: 0,
         }
     }
 
+    pub(crate) fn revision(&self) -> u64 {
+        self.revision
+    }
+
+    fn increment_revision(&mut self) {
+        self.revision = self.revision.wrapping_add(1);
+    }
+
     pub(crate) fn condition_evaluator_state_mut(
         &mut self,
     ) -> &mut loot_condition_interpreter::State {
+        self.increment_revision();
         &mut self.condition_evaluator_state
     }
 
     pub(crate) fn clear_condition_cache(&mut self) {
+        self.increment_revision();
         if let Err(e) = self.condition_evaluator_state.clear_condition_cache() {
             logging::error!("The condition cache's lock is poisoned, assigning a new cache");
             *e.into_inner() = HashMap::new();
@@ -86,6 +102,7 @@ impl Database {
     ///
     /// Replaces any existing data that was previously loaded from a masterlist.
     pub fn load_masterlist(&mut self, path: &Path) -> Result<(), LoadMetadataError> {
+        self.increment_revision();
         self.masterlist.load(path)
     }
 
@@ -99,6 +116,7 @@ impl Database {
         masterlist_path: &Path,
         prelude_path: &Path,
     ) -> Result<(), LoadMetadataError> {
+        self.increment_revision();
         self.masterlist
             .load_with_prelude(masterlist_path, prelude_path)
     }
@@ -107,6 +125,7 @@ impl Database {
     ///
     /// Replaces any existing data that was previously loaded from a userlist.
     pub fn load_userlist(&mut self, path: &Path) -> Result<(), LoadMetadataError> {
+        self.increment_revision();
         self.userlist.load(path)
     }
 
@@ -212,6 +231,7 @@ impl Database {
     /// Sets the group definitions to store in the userlist, replacing any
     /// definitions already loaded from the userlist.
     pub fn set_user_groups(&mut self, groups: Vec<Group>) {
+        self.increment_revision();
         self.userlist.set_groups(groups);
     }
 
@@ -266,6 +286,34 @@ impl Database {
         }
     }
 
+    /// Get all the loaded metadata of each of the given plugins.
+    ///
+    /// This is equivalent to calling [Database::plugin_metadata] for each
+    /// plugin, but the plugins' metadata is looked up and their conditions are
+    /// evaluated in parallel. The returned `Vec` has the same length and order
+    /// as `plugin_names`. If retrieving the metadata of more than one plugin
+    /// fails, the error for the first of those plugins is returned.
+    ///
+    /// Evaluating plugin metadata conditions does **not** clear the condition
+    /// cache.
+    pub fn plugins_metadata(
+        &self,
+        plugin_names: &[&str],
+        include_user_metadata: MergeMode,
+        evaluate_conditions: EvalMode,
+    ) -> Result<Vec<Option<PluginMetadata>>, MetadataRetrievalError> {
+        let results: Vec<_> = plugin_names
+            .par_iter()
+            .map(|plugin_name| {
+                self.plugin_metadata(plugin_name, include_user_metadata, evaluate_conditions)
+            })
+            .collect();
+
+        // Collect sequentially so that the error returned doesn't depend on
+        // the order in which the parallel lookups finished.
+        results.into_iter().collect()
+    }
+
     /// Get a plugin's metadata loaded from the given userlist.
     ///
     /// Evaluating plugin metadata conditions does **not** clear the condition
@@ -289,18 +337,21 @@ impl Database {
     /// Sets a plugin's user metadata, replacing any loaded user metadata for
     /// that plugin.
     pub fn set_plugin_user_metadata(&mut self, plugin_metadata: PluginMetadata) {
+        self.increment_revision();
         self.userlist.set_plugin_metadata(plugin_metadata);
     }
 
     /// Discards all loaded user metadata for the plugin with the given
     /// filename.
     pub fn discard_plugin_user_metadata(&mut self, plugin: &str) {
+        self.increment_revision();
         self.userlist.remove_plugin_metadata(plugin);
     }
 
     /// Discards all loaded user metadata for all groups, plugins, and any
     /// user-added general messages and known bash tags.
     pub fn discard_all_user_metadata(&mut self) {
+        self.increment_revision();
         self.userlist.clear();
     }
 }
@@ -1093,6 +1144,81 @@ plugins:
         }
     }
 
+    mod plugins_metadata {
+        use super::*;
+
+        #[test]
+        fn should_return_an_empty_vec_if_given_no_plugin_names() {
+            let fixture = Fixture::new(GameType::Oblivion);
+            let database = fixture.database();
+
+            assert!(
+                database
+                    .plugins_metadata(&[], MergeMode::WithUserMetadata, EvalMode::Evaluate)
+                    .unwrap()
+                    .is_empty()
+            );
+        }
+
+        #[test]
+        fn should_return_the_same_metadata_as_plugin_metadata_in_input_order() {
+            let fixture = Fixture::new(GameType::Oblivion);
+            let mut database = fixture.database();
+
+            database.load_masterlist(&fixture.metadata_path).unwrap();
+
+            let mut plugin = PluginMetadata::new(BLANK_ESM).unwrap();
+            plugin.set_load_after_files(vec![File::new(BLANK_DIFFERENT_ESM.into())]);
+
+            database.set_plugin_user_metadata(plugin);
+
+            let plugin_names = [BLANK_DIFFERENT_ESM, BLANK_ESM, "missing.esp", BLANK_ESM];
+            let metadata = database
+                .plugins_metadata(
+                    &plugin_names,
+                    MergeMode::WithUserMetadata,
+                    EvalMode::Evaluate,
+                )
+                .unwrap();
+
+            let expected: Vec<_> = plugin_names
+                .iter()
+                .map(|n| {
+                    database
+                        .plugin_metadata(n, MergeMode::WithUserMetadata, EvalMode::Evaluate)
+                        .unwrap()
+                })
+                .collect();
+
+            assert_eq!(expected, metadata);
+            assert!(metadata[2].is_none());
+        }
+
+        #[test]
+        fn should_filter_out_metadata_with_false_conditions_when_evaluating_conditions() {
+            let fixture = Fixture::new(GameType::Oblivion);
+            let mut database = fixture.database();
+
+            let mut plugin = PluginMetadata::new(BLANK_ESM).unwrap();
+            plugin.set_messages(vec![
+                Message::new(MessageType::Say, "content".into())
+                    .with_condition("file(\"missing.esp\")".into()),
+            ]);
+
+            database.set_plugin_user_metadata(plugin);
+
+            let metadata = database
+                .plugins_metadata(
+                    &[BLANK_ESM],
+                    MergeMode::WithUserMetadata,
+                    EvalMode::Evaluate,
+                )
+                .unwrap();
+
+            assert!(metadata[0].as_ref().unwrap().messages().is_empty());
+        }
+    }
+
     mod plugin_user_metadata {
         use super::*;
 
@@ -1,15 +1,17 @@
 use std::{
-    collections::{HashMap, HashSet},
+    collections::{BTreeMap, HashMap, HashSet},
     fmt::Display,
     path::{Path, PathBuf},
-    sync::{Arc, RwLock},
+    sync::{Arc, Mutex, MutexGuard, RwLock},
+    time::SystemTime,
 };
 
 use loadorder::WritableLoadOrder;
-use rayon::iter::{IntoParallelRefIterator, ParallelIterator};
+use rayon::iter::{IntoParallelRefIterator, IntoParallelRefMutIterator, ParallelIterator};
 
 use crate::{
     EvalMode, LogLevel, MergeMode,
+    archive::{ArchiveAssets, assets_in_archive, find_associated_archives},
     database::Database,
     error::{
         DatabaseLockPoisonError, GameHandleCreationError, LoadOrderError, LoadOrderStateError,
@@ -19,10 +21,11 @@ use crate::{
     logging::{self, format_details, is_log_enabled},
     metadata::{
         Filename,
-        plugin_metadata::{GHOST_FILE_EXTENSION, iends_with_ascii},
+        plugin_metadata::{GHOST_FILE_EXTENSION, iends_with_ascii, trim_dot_ghost},
     },
     plugin::{
-        LoadScope, Plugin,
+        LoadScope, Plugin, ReadMode,
+        crc_cache::{FileKey, PersistentCrcCache},
         error::{InvalidFilenameReason, PluginValidationError},
         plugins_metadata, validate_plugin_path_and_header,
     },
@@ -145,6 +148,14 @@ pub struct Game {
     // loading plugins.
     database: Arc<RwLock<Database>>,
     cache: GameCache,
+    cache_sort_results: bool,
+    plugin_read_mode: ReadMode,
+    plugin_cache_directory: Option<PathBuf>,
+    // The CRCs of plugins that have been replaced or cleared since the plugin
+    // cache was last saved.
+    unsaved_crcs: BTreeMap<FileKey, u32>,
+    // Stored in a Mutex because sorting only borrows the game immutably.
+    sort_result_cache: Mutex<Option<CachedSortResult>>,
 }
 
 impl Game {
@@ -184,6 +195,11 @@ impl Game {
             load_order,
             database: Arc::new(RwLock::new(Database::new(condition_evaluator_state))),
             cache: GameCache::default(),
+            cache_sort_results: false,
+            plugin_read_mode: ReadMode::default(),
+            plugin_cache_directory: None,
+            unsaved_crcs: BTreeMap::new(),
+            sort_result_cache: Mutex::default(),
         })
     }
 
@@ -238,6 +254,11 @@ impl Game {
             load_order,
             database: Arc::new(RwLock::new(Database::new(condition_evaluator_state))),
             cache: GameCache::default(),
+            cache_sort_results: false,
+            plugin_read_mode: ReadMode::default(),
+            plugin_cache_directory: None,
+            unsaved_crcs: BTreeMap::new(),
+            sort_result_cache: Mutex::default(),
         })
     }
 
@@ -329,6 +350,10 @@ impl Game {
     pub fn load_plugins(&mut self, plugin_paths: &[&Path]) -> Result<(), LoadPluginsError> {
         let mut plugins = self.load_plugins_common(plugin_paths, LoadScope::WholePlugin)?;
 
+        if let Some(cache_directory) = &self.plugin_cache_directory {
+            restore_cached_crcs(cache_directory, &plugins);
+        }
+
         if matches!(
             self.base_type,
             GameType::Morrowind | GameType::OpenMW | GameType::Starfield
@@ -393,18 +418,63 @@ impl Game {
 
         logging::trace!("Starting loading {load_scope}s.");
 
-        let plugins: Vec<_> = plugin_paths
-            .par_iter()
-            .filter_map(|path| {
-                try_load_plugin(&data_path, path, self.base_type, &self.cache, load_scope)
-            })
-            .collect();
+        let mut plugins: Vec<_> = {
+            let database = self.database.read()?;
+            plugin_paths
+                .par_iter()
+                .filter_map(|path| {
+                    let resolved_path = resolve_plugin_path(self.base_type, &data_path, path);
+                    let read_mode = if load_scope == LoadScope::WholePlugin {
+                        plugin_read_mode(&database, path, self.plugin_read_mode)
+                    } else {
+                        self.plugin_read_mode
+                    };
+
+                    try_load_plugin(path, &resolved_path, self.base_type, load_scope, read_mode)
+                        .map(|plugin| (resolved_path, plugin))
+                })
+                .collect()
+        };
+
+        // Only find the archives of plugins that loaded and can load archives.
+        plugins.par_iter_mut().for_each(|(resolved_path, plugin)| {
+            if plugin.can_load_archives() {
+                plugin.set_archive_paths(find_associated_archives(
+                    self.base_type,
+                    &self.cache,
+                    resolved_path,
+                ));
+            }
+        });
+
+        if load_scope == LoadScope::WholePlugin {
+            // Index the assets of all the archives that the plugins load before
+            // getting each plugin's archive assets, so that an archive that is
+            // loaded by more than one plugin is only parsed once.
+            let plugin_archive_paths = plugins
+                .iter()
+                .flat_map(|(_, plugin)| plugin.archive_paths().iter().cloned())
+                .collect();
+
+            self.cache.update_archive_index(&plugin_archive_paths);
+
+            plugins
+                .par_iter_mut()
+                .for_each(|(_, plugin)| plugin.load_archive_assets(&self.cache));
+        }
+
+        let plugins = plugins.into_iter().map(|(_, plugin)| plugin).collect();
 
         Ok(plugins)
     }
 
     fn store_plugins(&mut self, plugins: Vec<Plugin>) -> Result<(), DatabaseLockPoisonError> {
+        // Some of the loaded plugins may be about to be replaced, so keep any
+        // CRCs that have been calculated for them until the cache is saved.
+        self.retain_calculated_crcs();
+
         self.cache.insert_plugins(plugins);
+        self.clear_sort_result_cache();
 
         let mut database = self.database.write()?;
         update_loaded_plugin_state(
@@ -418,7 +488,9 @@ impl Game {
     /// Clears the plugins loaded by previous calls to [`Game::load_plugins`] or
     /// [`Game::load_plugin_headers`].
     pub fn clear_loaded_plugins(&mut self) {
+        self.retain_calculated_crcs();
         self.cache.clear_plugins();
+        self.clear_sort_result_cache();
     }
 
     /// Get data for a loaded plugin.
@@ -431,6 +503,88 @@ impl Game {
         self.cache.plugins_iter().cloned().collect()
     }
 
+    /// Set whether plugin files should be memory-mapped when they are loaded.
+    ///
+    /// If enabled, [`Game::load_plugins`] memory-maps each plugin file and
+    /// parses it from the mapped memory instead of reading it into a buffer,
+    /// falling back to buffered reads for any file that can't be memory-mapped.
+    /// [`Game::load_plugin_headers`] and OpenMW's .omwscripts files are not
+    /// affected. This can reduce the cost of loading large plugins, but plugin
+    /// files must not be modified by another process while they are being
+    /// loaded. Memory mapping is disabled by default.
+    pub fn set_plugin_memory_mapping(&mut self, memory_map_plugins: bool) {
+        self.plugin_read_mode = if memory_map_plugins {
+            ReadMode::MemoryMapped
+        } else {
+            ReadMode::Buffered
+        };
+    }
+
+    /// Set the directory in which plugin CRCs are cached between processes.
+    ///
+    /// If a directory is set, [`Game::load_plugins`] reuses the CRCs of plugins
+    /// that have not changed since they were cached in a cache file in that
+    /// directory. The CRCs of other plugins are still only calculated when
+    /// they are needed, and are only written to the cache file by
+    /// [`Game::save_plugin_cache`].
+    ///
+    /// A plugin is treated as unchanged if its size and last modified time
+    /// are the same as when its CRC was cached. Cached CRCs are ignored if
+    /// they were written by a different version of libloot. No directory is
+    /// set by default, and setting no directory discards any CRCs that have
+    /// not been saved.
+    pub fn set_plugin_cache_directory(&mut self, cache_directory: Option<PathBuf>) {
+        if cache_directory.is_none() {
+            self.unsaved_crcs.clear();
+        }
+        self.plugin_cache_directory = cache_directory;
+    }
+
+    /// Write the CRCs that have been calculated for plugins to the cache file
+    /// in the directory set using [`Game::set_plugin_cache_directory`].
+    ///
+    /// This includes the CRCs of plugins that were loaded while the directory
+    /// was set but have since been replaced or cleared. Entries for plugins
+    /// that no longer exist or have changed are removed from the cache file
+    /// when it is written. The cache file is only written if a directory is
+    /// set and it would change.
+    pub fn save_plugin_cache(&mut self) -> std::io::Result<()> {
+        self.retain_calculated_crcs();
+
+        if let Some(cache_directory) = &self.plugin_cache_directory {
+            save_calculated_crcs(cache_directory, &self.unsaved_crcs)?;
+        }
+
+        self.unsaved_crcs.clear();
+
+        Ok(())
+    }
+
+    fn retain_calculated_crcs(&mut self) {
+        if self.plugin_cache_directory.is_none() {
+            return;
+        }
+
+        for plugin in self.cache.plugins_iter() {
+            if let (Some(key), Some(crc)) = (plugin.crc_file(), plugin.calculated_crc()) {
+                self.unsaved_crcs.insert(key.clone(), crc);
+            }
+        }
+    }
+
+    /// Set whether the result of sorting plugins should be cached.
+    ///
+    /// If enabled, [`Game::sort_plugins`] returns the result of the previous
+    /// sort without sorting again if it is given the same plugins in the same
+    /// order and no plugins, metadata or load order state have been loaded or
+    /// changed since that sort. Caching is disabled by default.
+    pub fn set_sort_result_caching(&mut self, cache_sort_results: bool) {
+        self.cache_sort_results = cache_sort_results;
+        if !cache_sort_results {
+            self.clear_sort_result_cache();
+        }
+    }
+
     /// Calculates a new load order for the game's installed plugins (including
     /// inactive plugins) and returns the sorted order.
     ///
@@ -442,6 +596,10 @@ impl Game {
     /// The order in which plugins are listed in `plugin_filenames` is used as
     /// their current load order. All given plugins must have been already been
     /// loaded using [`Game::load_plugins`] or [`Game::load_plugin_headers`].
+    ///
+    /// If sort result caching is enabled using
+    /// [`Game::set_sort_result_caching`], the sorted load order may be the
+    /// cached result of a previous sort with the same inputs.
     pub fn sort_plugins(&self, plugin_names: &[&str]) -> Result<Vec<String>, SortPluginsError> {
         let plugins = plugin_names
             .iter()
@@ -453,6 +611,21 @@ impl Game {
             .collect::<Result<Vec<_>, _>>()?;
 
         let database = self.database.read()?;
+        let early_loading_plugins = self.load_order.game_settings().early_loading_plugins();
+
+        let sort_inputs = self
+            .cache_sort_results
+            .then(|| SortInputs::new(&plugins, database.revision(), early_loading_plugins));
+
+        if let Some(load_order) = sort_inputs
+            .as_ref()
+            .and_then(|i| self.cached_sort_result(i))
+        {
+            logging::debug!(
+                "The plugins, metadata and load order state are unchanged since the last sort, reusing its result"
+            );
+            return Ok(load_order);
+        }
 
         let plugins_sorting_data = plugins
             .into_iter()
@@ -472,11 +645,8 @@ impl Game {
             database.user_groups(),
         )?;
 
-        let new_load_order = sort_plugins(
-            plugins_sorting_data,
-            &groups_graph,
-            self.load_order.game_settings().early_loading_plugins(),
-        )?;
+        let new_load_order =
+            sort_plugins(plugins_sorting_data, &groups_graph, early_loading_plugins)?;
 
         if is_log_enabled(LogLevel::Debug) {
             logging::debug!("Sorted load order:");
@@ -485,9 +655,43 @@ impl Game {
             }
         }
 
+        if let Some(inputs) = sort_inputs {
+            *self.lock_sort_result_cache() = Some(CachedSortResult {
+                inputs,
+                load_order: new_load_order.clone(),
+            });
+        }
+
         Ok(new_load_order)
     }
 
+    fn cached_sort_result(&self, inputs: &SortInputs) -> Option<Vec<String>> {
+        self.lock_sort_result_cache()
+            .as_ref()
+            .filter(|c| c.inputs == *inputs)
+            .map(|c| c.load_order.clone())
+    }
+
+    fn lock_sort_result_cache(&self) -> MutexGuard<'_, Option<CachedSortResult>> {
+        match self.sort_result_cache.lock() {
+            Ok(cache) => cache,
+            Err(e) => {
+                self.sort_result_cache.clear_poison();
+                e.into_inner()
+            }
+        }
+    }
+
+    fn clear_sort_result_cache(&mut self) {
+        match self.sort_result_cache.get_mut() {
+            Ok(cache) => *cache = None,
+            Err(e) => {
+                *e.into_inner() = None;
+                self.sort_result_cache.clear_poison();
+            }
+        }
+    }
+
     /// Load the current load order state, discarding any previously held state.
     ///
     /// This function should be called whenever the load order or active state
@@ -665,16 +869,41 @@ fn find_archives_in_path(
     Ok(paths)
 }
 
+/// Buffered reads of plugins that have cleaning data also calculate the
+/// plugins' CRCs, as the CRCs are needed to evaluate that data, so this avoids
+/// reading those plugins twice. Memory-mapped plugins are left to calculate
+/// their CRCs lazily.
+fn plugin_read_mode(database: &Database, plugin_path: &Path, read_mode: ReadMode) -> ReadMode {
+    if read_mode != ReadMode::Buffered {
+        return read_mode;
+    }
+
+    let Some(plugin_name) = plugin_path.file_name().and_then(|n| n.to_str()) else {
+        return read_mode;
+    };
+
+    match database.plugin_metadata(
+        trim_dot_ghost(plugin_name),
+        MergeMode::WithUserMetadata,
+        EvalMode::DoNotEvaluate,
+    ) {
+        Ok(Some(metadata))
+            if !metadata.dirty_info().is_empty() || !metadata.clean_info().is_empty() =>
+        {
+            ReadMode::BufferedWithCrc
+        }
+        _ => read_mode,
+    }
+}
+
 fn try_load_plugin(
-    data_path: &Path,
     plugin_path: &Path,
+    resolved_path: &Path,
     game_type: GameType,
-    game_cache: &GameCache,
     load_scope: LoadScope,
+    read_mode: ReadMode,
 ) -> Option<Plugin> {
-    let resolved_path = resolve_plugin_path(game_type, data_path, plugin_path);
-
-    match Plugin::new(game_type, game_cache, &resolved_path, load_scope) {
+    match Plugin::load(game_type, resolved_path, load_scope, read_mode) {
         Ok(p) => Some(p),
         Err(e) => {
             logging::error!(
@@ -687,6 +916,69 @@ fn try_load_plugin(
     }
 }
 
+fn restore_cached_crcs(cache_directory: &Path, plugins: &[Plugin]) {
+    let cache = PersistentCrcCache::load(cache_directory);
+
+    for plugin in plugins {
+        if plugin.calculated_crc().is_some() {
+            continue;
+        }
+
+        let Some(key) = plugin.crc_file().and_then(canonicalize_file_key) else {
+            continue;
+        };
+
+        if let Some(crc) = cache.get(&key) {
+            plugin.set_calculated_crc(crc);
+        } else {
+            logging::debug!(
+                "The plugin CRC cache has no CRC for \"{}\" with its current size and modification time",
+                escape_ascii(key.path())
+            );
+        }
+    }
+}
+
+fn save_calculated_crcs(
+    cache_directory: &Path,
+    calculated_crcs: &BTreeMap<FileKey, u32>,
+) -> std::io::Result<()> {
+    if calculated_crcs.is_empty() {
+        return Ok(());
+    }
+
+    let mut cache = PersistentCrcCache::load(cache_directory);
+
+    let mut is_changed = false;
+    for (key, crc) in calculated_crcs {
+        if let Some(key) = canonicalize_file_key(key) {
+            is_changed |= cache.insert(key, *crc);
+        }
+    }
+
+    if !is_changed {
+        return Ok(());
+    }
+
+    cache.remove_stale_entries();
+
+    cache.save(cache_directory)
+}
+
+fn canonicalize_file_key(key: &FileKey) -> Option<FileKey> {
+    match key.canonicalize() {
+        Ok(key) => Some(key),
+        Err(e) => {
+            logging::debug!(
+                "Could not resolve the path \"{}\", so it will not be looked up in the plugin CRC cache: {}",
+                escape_ascii(key.path()),
+                e
+            );
+            None
+        }
+    }
+}
+
 fn resolve_plugin_path(game_type: GameType, data_path: &Path, plugin_path: &Path) -> PathBuf {
     let plugin_path = data_path.join(plugin_path);
 
@@ -720,7 +1012,10 @@ fn update_loaded_plugin_state<'a>(
             plugin_versions.push((plugin.name(), version));
         }
 
-        if let Some(crc) = plugin.crc() {
+        // Only pass on CRCs that have already been calculated, as the condition
+        // interpreter calculates and caches any other CRCs that it needs when
+        // evaluating conditions.
+        if let Some(crc) = plugin.calculated_crc() {
             plugin_crcs.push((plugin.name(), crc));
         }
     }
@@ -773,10 +1068,46 @@ fn to_plugin_sorting_data<'a>(
     .map_err(Into::into)
 }
 
+/// The inputs that the result of sorting plugins depends on.
+#[derive(Clone, Debug, Eq, PartialEq)]
+struct SortInputs {
+    /// The IDs of the plugins' loaded data, in their current load order.
+    plugin_ids: Vec<u64>,
+    database_revision: u64,
+    early_loading_plugins: Vec<String>,
+}
+
+impl SortInputs {
+    fn new(
+        plugins: &[&Arc<Plugin>],
+        database_revision: u64,
+        early_loading_plugins: &[String],
+    ) -> Self {
+        Self {
+            plugin_ids: plugins.iter().map(|p| p.id()).collect(),
+            database_revision,
+            early_loading_plugins: early_loading_plugins.to_vec(),
+        }
+    }
+}
+
+#[derive(Clone, Debug, Eq, PartialEq)]
+struct CachedSortResult {
+    inputs: SortInputs,
+    load_order: Vec<String>,
+}
+
+#[derive(Clone, Debug, Eq, PartialEq)]
+struct IndexedArchive {
+    modified: Option<SystemTime>,
+    assets: Arc<ArchiveAssets>,
+}
+
 #[derive(Clone, Debug, Default, Eq, PartialEq)]
 pub(crate) struct GameCache {
     plugins: HashMap<Filename, Arc<Plugin>>,
     archive_paths: HashSet<PathBuf>,
+    archive_index: HashMap<PathBuf, IndexedArchive>,
 }
 
 impl GameCache {
@@ -785,15 +1116,66 @@ impl GameCache {
         self.archive_paths.extend(archive_paths);
     }
 
+    /// Make sure that the archive index holds the current assets of the given
+    /// archives, parsing in parallel any archives that are not yet indexed or
+    /// that have been modified since they were indexed.
+    ///
+    /// Archives that are no longer needed are removed from the index when
+    /// plugins are stored.
+    fn update_archive_index(&mut self, archive_paths: &HashSet<PathBuf>) {
+        let new_entries: Vec<_> = archive_paths
+            .par_iter()
+            .filter_map(|path| {
+                let modified = path.metadata().and_then(|m| m.modified()).ok();
+                let is_current = modified.is_some()
+                    && self
+                        .archive_index
+                        .get(path)
+                        .is_some_and(|a| a.modified == modified);
+
+                (!is_current).then(|| {
+                    let assets = Arc::new(assets_in_archive(path));
+                    (path.clone(), IndexedArchive { modified, assets })
+                })
+            })
+            .collect();
+
+        self.archive_index.extend(new_entries);
+    }
+
+    /// Get the indexed assets of the archive at the given path.
+    pub(crate) fn archive_assets(&self, archive_path: &Path) -> Option<Arc<ArchiveAssets>> {
+        self.archive_index
+            .get(archive_path)
+            .map(|a| Arc::clone(&a.assets))
+    }
+
     fn insert_plugins(&mut self, plugins: Vec<Plugin>) {
         for plugin in plugins {
             self.plugins
                 .insert(Filename::new(plugin.name().to_owned()), Arc::new(plugin));
         }
+
+        // Plugins that have been replaced can't be compared against again, so
+        // drop their cached record overlaps.
+        let plugin_ids: HashSet<u64> = self.plugins.values().map(|p| p.id()).collect();
+        self.plugins
+            .values()
+            .for_each(|p| p.retain_record_overlaps(&plugin_ids));
+
+        // Only keep the indexed archives that the loaded plugins use.
+        let loaded_archive_paths: HashSet<&PathBuf> = self
+            .plugins
+            .values()
+            .flat_map(|p| p.archive_paths())
+            .collect();
+        self.archive_index
+            .retain(|path, _| loaded_archive_paths.contains(path));
     }
 
     fn clear_plugins(&mut self) {
         self.plugins.clear();
+        self.archive_index.clear();
     }
 
     fn plugins(&self) -> &HashMap<Filename, Arc<Plugin>> {
@@ -820,7 +1202,7 @@ mod tests {
     use array_parameterized_test::parameterized_test;
 
     use crate::{
-        metadata::{File, PluginMetadata},
+        metadata::{File, PluginCleaningData, PluginMetadata},
         tests::{
             ALL_GAME_TYPES, BLANK_DIFFERENT_ESM, BLANK_DIFFERENT_ESP, BLANK_ESM, BLANK_ESP,
             BLANK_MASTER_DEPENDENT_ESM, Fixture,
@@ -1555,6 +1937,129 @@ mod tests {
                 assert!(game.plugin(BLANK_ESP).is_some());
             }
 
+            #[test]
+            fn should_calculate_the_crcs_of_plugins_with_cleaning_data() {
+                let fixture = Fixture::new(GameType::Oblivion);
+
+                let mut game = Game::with_local_path(
+                    fixture.game_type,
+                    &fixture.game_path,
+                    &fixture.local_path,
+                )
+                .unwrap();
+
+                let mut metadata = PluginMetadata::new(BLANK_ESM).unwrap();
+                metadata
+                    .set_dirty_info(vec![PluginCleaningData::new(0x1234_5678, "utility".into())]);
+                game.database()
+                    .write()
+                    .unwrap()
+                    .set_plugin_user_metadata(metadata);
+
+                game.load_plugins(&[Path::new(BLANK_ESM), Path::new(BLANK_ESP)])
+                    .unwrap();
+
+                let plugin = game.plugin(BLANK_ESM).unwrap();
+                let expected_crc =
+                    crc32fast::hash(&std::fs::read(fixture.data_path().join(BLANK_ESM)).unwrap());
+                assert_eq!(Some(expected_crc), plugin.calculated_crc());
+
+                assert!(game.plugin(BLANK_ESP).unwrap().calculated_crc().is_none());
+            }
+
+            #[test]
+            fn should_restore_cached_crcs_if_a_plugin_cache_directory_is_set() {
+                let fixture = Fixture::new(GameType::Oblivion);
+                let cache_directory = fixture.local_path.join("cache");
+
+                let mut game = Game::with_local_path(
+                    fixture.game_type,
+                    &fixture.game_path,
+                    &fixture.local_path,
+                )
+                .unwrap();
+
+                game.load_plugins(&[Path::new(BLANK_ESM)]).unwrap();
+                assert!(game.plugin(BLANK_ESM).unwrap().calculated_crc().is_none());
+
+                let plugin_path = fixture.data_path().join(BLANK_ESM);
+                let mut cache = PersistentCrcCache::default();
+                cache.insert(
+                    FileKey::new(&plugin_path).unwrap().canonicalize().unwrap(),
+                    0x1234_5678,
+                );
+                cache.save(&cache_directory).unwrap();
+
+                game.set_plugin_cache_directory(Some(cache_directory.clone()));
+                game.load_plugins(&[Path::new(BLANK_ESM), Path::new(BLANK_ESP)])
+                    .unwrap();
+
+                assert_eq!(0x1234_5678, game.plugin(BLANK_ESM).unwrap().crc().unwrap());
+                assert!(game.plugin(BLANK_ESP).unwrap().calculated_crc().is_none());
+            }
+
+            #[test]
+            fn save_plugin_cache_should_cache_the_calculated_crcs_of_loaded_and_cleared_plugins() {
+                let fixture = Fixture::new(GameType::Oblivion);
+                let cache_directory = fixture.local_path.join("cache");
+                let esm_key = FileKey::new(&fixture.data_path().join(BLANK_ESM))
+                    .unwrap()
+                    .canonicalize()
+                    .unwrap();
+                let esp_key = FileKey::new(&fixture.data_path().join(BLANK_ESP))
+                    .unwrap()
+                    .canonicalize()
+                    .unwrap();
+
+                let mut game = Game::with_local_path(
+                    fixture.game_type,
+                    &fixture.game_path,
+                    &fixture.local_path,
+                )
+                .unwrap();
+                game.set_plugin_cache_directory(Some(cache_directory.clone()));
+
+                game.load_plugins(&[Path::new(BLANK_ESM), Path::new(BLANK_ESP)])
+                    .unwrap();
+                let esm_crc = game.plugin(BLANK_ESM).unwrap().crc().unwrap();
+
+                game.clear_loaded_plugins();
+                assert!(!cache_directory.exists());
+
+                game.load_plugins(&[Path::new(BLANK_ESP)]).unwrap();
+                let esp_crc = game.plugin(BLANK_ESP).unwrap().crc().unwrap();
+
+                game.save_plugin_cache().unwrap();
+
+                let cache = PersistentCrcCache::load(&cache_directory);
+                assert_eq!(Some(esm_crc), cache.get(&esm_key));
+                assert_eq!(Some(esp_crc), cache.get(&esp_key));
+            }
+
+            #[parameterized_test(ALL_GAME_TYPES)]
+            fn should_load_the_same_data_if_plugin_memory_mapping_is_enabled(game_type: GameType) {
+                let fixture = Fixture::new(game_type);
+
+                let mut game = Game::with_local_path(
+                    fixture.game_type,
+                    &fixture.game_path,
+                    &fixture.local_path,
+                )
+                .unwrap();
+
+                let paths = [Path::new(BLANK_ESM), Path::new(BLANK_ESP)];
+
+                game.load_plugins(&paths).unwrap();
+                let buffered_esm = game.plugin(BLANK_ESM).unwrap();
+                let buffered_esp = game.plugin(BLANK_ESP).unwrap();
+
+                game.set_plugin_memory_mapping(true);
+                game.load_plugins(&paths).unwrap();
+
+                assert_eq!(buffered_esm, game.plugin(BLANK_ESM).unwrap());
+                assert_eq!(buffered_esp, game.plugin(BLANK_ESP).unwrap());
+            }
+
             #[test]
             fn should_not_clear_the_plugins_cache() {
                 let fixture = Fixture::new(GameType::Morrowind);
@@ -1761,6 +2266,103 @@ mod tests {
                 assert_eq!(1, game.cache.archive_paths.len());
             }
 
+            #[test]
+            fn should_parse_an_archive_loaded_by_more_than_one_plugin_only_once() {
+                let fixture = Fixture::new(GameType::Oblivion);
+
+                let archive_path = fixture.data_path().join("Blank - Different.bsa");
+                std::fs::copy(
+                    crate::tests::source_plugins_path(GameType::Oblivion).join("Blank.bsa"),
+                    &archive_path,
+                )
+                .unwrap();
+
+                let mut game = Game::with_local_path(
+                    fixture.game_type,
+                    &fixture.game_path,
+                    &fixture.local_path,
+                )
+                .unwrap();
+
+                let plugin_paths = [Path::new(BLANK_ESP), Path::new(BLANK_DIFFERENT_ESP)];
+                let plugins = game
+                    .load_plugins_common(&plugin_paths, LoadScope::WholePlugin)
+                    .unwrap();
+
+                let assets = game.cache.archive_assets(&archive_path).unwrap();
+                assert!(!assets.is_empty());
+                assert_eq!(1, game.cache.archive_index.len());
+
+                // Both plugins load the archive and share its indexed assets
+                // with the index and this test.
+                assert_eq!(4, Arc::strong_count(&assets));
+                assert!(plugins[0].do_assets_overlap(&plugins[1]));
+
+                game.load_plugins_common(&plugin_paths, LoadScope::WholePlugin)
+                    .unwrap();
+
+                assert!(Arc::ptr_eq(
+                    &assets,
+                    &game.cache.archive_assets(&archive_path).unwrap()
+                ));
+            }
+
+            #[test]
+            fn should_only_keep_indexed_archives_that_loaded_plugins_use() {
+                let fixture = Fixture::new(GameType::Oblivion);
+
+                let source_archive_path =
+                    crate::tests::source_plugins_path(GameType::Oblivion).join("Blank.bsa");
+                let archive_path = fixture.data_path().join("Blank.bsa");
+                let different_archive_path = fixture.data_path().join("Blank - Different.bsa");
+                std::fs::copy(&source_archive_path, &archive_path).unwrap();
+                std::fs::copy(&source_archive_path, &different_archive_path).unwrap();
+
+                let mut game = Game::with_local_path(
+                    fixture.game_type,
+                    &fixture.game_path,
+                    &fixture.local_path,
+                )
+                .unwrap();
+
+                game.load_plugins(&[Path::new(BLANK_ESP), Path::new(BLANK_DIFFERENT_ESP)])
+                    .unwrap();
+                assert_eq!(2, game.cache.archive_index.len());
+
+                game.clear_loaded_plugins();
+                assert!(game.cache.archive_index.is_empty());
+
+                // Blank.esp loads both archives, but Blank - Different.esp
+                // only loads the one with the same basename.
+                game.load_plugins(&[Path::new(BLANK_DIFFERENT_ESP)])
+                    .unwrap();
+                assert_eq!(1, game.cache.archive_index.len());
+                assert!(game.cache.archive_assets(&different_archive_path).is_some());
+            }
+
+            #[test]
+            fn should_not_index_archives_when_loading_plugin_headers() {
+                let fixture = Fixture::new(GameType::Oblivion);
+
+                std::fs::copy(
+                    crate::tests::source_plugins_path(GameType::Oblivion).join("Blank.bsa"),
+                    fixture.data_path().join("Blank.bsa"),
+                )
+                .unwrap();
+
+                let mut game = Game::with_local_path(
+                    fixture.game_type,
+                    &fixture.game_path,
+                    &fixture.local_path,
+                )
+                .unwrap();
+
+                game.load_plugins_common(&[Path::new(BLANK_ESP)], LoadScope::HeaderOnly)
+                    .unwrap();
+
+                assert!(game.cache.archive_index.is_empty());
+            }
+
             #[test]
             fn should_not_error_if_an_installed_filename_has_non_windows_1252_encodable_characters()
             {
@@ -1959,6 +2561,104 @@ mod tests {
 
                 assert!(game.sort_plugins(&[BLANK_ESP]).is_err());
             }
+
+            #[test]
+            fn should_not_cache_the_result_by_default() {
+                let fixture = Fixture::new(GameType::Oblivion);
+
+                let mut game = Game::with_local_path(
+                    fixture.game_type,
+                    &fixture.game_path,
+                    &fixture.local_path,
+                )
+                .unwrap();
+
+                load_all_installed_plugins(&mut game, &fixture);
+
+                game.sort_plugins(&[BLANK_ESP, BLANK_DIFFERENT_ESP])
+                    .unwrap();
+
+                assert!(game.lock_sort_result_cache().is_none());
+            }
+
+            #[test]
+            fn should_reuse_the_cached_result_if_the_inputs_are_unchanged() {
+                let fixture = Fixture::new(GameType::Oblivion);
+
+                let mut game = Game::with_local_path(
+                    fixture.game_type,
+                    &fixture.game_path,
+                    &fixture.local_path,
+                )
+                .unwrap();
+
+                load_all_installed_plugins(&mut game, &fixture);
+                game.set_sort_result_caching(true);
+
+                let input = &[BLANK_ESP, BLANK_DIFFERENT_ESP];
+                let sorted = game.sort_plugins(input).unwrap();
+
+                let cached_load_order = game
+                    .lock_sort_result_cache()
+                    .as_ref()
+                    .map(|c| c.load_order.clone());
+                assert_eq!(Some(sorted.clone()), cached_load_order);
+
+                assert_eq!(sorted, game.sort_plugins(input).unwrap());
+            }
+
+            #[test]
+            fn should_not_reuse_the_cached_result_if_metadata_has_changed() {
+                let fixture = Fixture::new(GameType::Oblivion);
+
+                let mut game = Game::with_local_path(
+                    fixture.game_type,
+                    &fixture.game_path,
+                    &fixture.local_path,
+                )
+                .unwrap();
+
+                load_all_installed_plugins(&mut game, &fixture);
+                game.set_sort_result_caching(true);
+
+                let input = &[BLANK_ESP, BLANK_DIFFERENT_ESP];
+                assert_eq!(input, game.sort_plugins(input).unwrap().as_slice());
+
+                let mut metadata = PluginMetadata::new(BLANK_ESP).unwrap();
+                metadata.set_load_after_files(vec![File::new(BLANK_DIFFERENT_ESP.to_owned())]);
+                game.database()
+                    .write()
+                    .unwrap()
+                    .set_plugin_user_metadata(metadata);
+
+                assert_eq!(
+                    &[BLANK_DIFFERENT_ESP, BLANK_ESP],
+                    game.sort_plugins(input).unwrap().as_slice()
+                );
+            }
+
+            #[test]
+            fn should_clear_the_cached_result_when_plugins_are_loaded() {
+                let fixture = Fixture::new(GameType::Oblivion);
+
+                let mut game = Game::with_local_path(
+                    fixture.game_type,
+                    &fixture.game_path,
+                    &fixture.local_path,
+                )
+                .unwrap();
+
+                load_all_installed_plugins(&mut game, &fixture);
+                game.set_sort_result_caching(true);
+
+                game.sort_plugins(&[BLANK_ESP, BLANK_DIFFERENT_ESP])
+                    .unwrap();
+                assert!(game.lock_sort_result_cache().is_some());
+
+                game.load_plugin_headers(&[Path::new(BLANK_ESP)]).unwrap();
+
+                assert!(game.lock_sort_result_cache().is_none());
+            }
         }
 
         mod is_plugin_active {
@@ -2058,6 +2758,7 @@ mod tests {
                 &GameCache::default(),
                 &fixture.data_path().join(BLANK_ESP),
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap(),
         );
@@ -2115,6 +2816,7 @@ mod tests {
                         &cache,
                         &source_plugins_path(GameType::Oblivion).join(BLANK_ESM),
                         LoadScope::HeaderOnly,
+                        ReadMode::Buffered,
                     )
                     .unwrap(),
                 ]);
@@ -2132,6 +2834,7 @@ mod tests {
                         &cache,
                         &source_plugins_path(GameType::Oblivion).join(BLANK_ESM),
                         LoadScope::HeaderOnly,
+                        ReadMode::Buffered,
                     )
                     .unwrap(),
                 ]);
@@ -2144,6 +2847,7 @@ mod tests {
                         &cache,
                         &source_plugins_path(GameType::Oblivion).join(BLANK_ESM),
                         LoadScope::WholePlugin,
+                        ReadMode::Buffered,
                     )
                     .unwrap(),
                 ]);
@@ -2165,6 +2869,7 @@ mod tests {
                         &cache,
                         &source_plugins_path(GameType::Oblivion).join(BLANK_ESM),
                         LoadScope::HeaderOnly,
+                        ReadMode::Buffered,
                     )
                     .unwrap(),
                 ]);
@@ -2193,6 +2898,7 @@ mod tests {
                         &cache,
                         &source_plugins_path(GameType::Oblivion).join(BLANK_ESM),
                         LoadScope::HeaderOnly,
+                        ReadMode::Buffered,
                     )
                     .unwrap(),
                 ]);
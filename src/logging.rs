@@ -1,10 +1,22 @@
-use std::sync::{LazyLock, RwLock};
+use std::sync::{
+    LazyLock, RwLock,
+    atomic::{AtomicBool, AtomicU8, Ordering},
+};
 
 type Callback = dyn Fn(LogLevel, &str) + Send + Sync;
 
-pub(crate) static LOGGER: LazyLock<RwLock<Logger>> =
+static LOGGER: LazyLock<RwLock<Logger>> =
     LazyLock::new(|| RwLock::new(Logger::new(Box::new(|_, _| {}))));
 
+/// The minimum level of messages that are passed to the callback. This is
+/// stored outside of [LOGGER] so that it can be checked before a message is
+/// formatted and without taking the lock.
+static CALLBACK_LEVEL: AtomicU8 = AtomicU8::new(LogLevel::Trace.as_u8());
+
+/// False until a callback has been set, as there's no point formatting a
+/// message for the default callback, which does nothing.
+static HAS_CALLBACK: AtomicBool = AtomicBool::new(false);
+
 /// Set the callback function that is called when logging.
 ///
 /// The `callback` function's first parameter is the level of the message being
@@ -22,19 +34,15 @@ where
             LOGGER.clear_poison();
         }
     }
+
+    HAS_CALLBACK.store(true, Ordering::Relaxed);
 }
 
 /// Set the log severity level.
 ///
 /// The default level setting is trace. This function has no effect if no logging callback has been set.
 pub fn set_log_level(level: LogLevel) {
-    match LOGGER.write() {
-        Ok(mut logger) => logger.set_level(level),
-        Err(e) => {
-            e.into_inner().set_level(level);
-            LOGGER.clear_poison();
-        }
-    }
+    CALLBACK_LEVEL.store(level.as_u8(), Ordering::Relaxed);
 }
 
 /// Codes used to specify different levels of API logging.
@@ -51,6 +59,18 @@ pub enum LogLevel {
     Error,
 }
 
+impl LogLevel {
+    const fn as_u8(self) -> u8 {
+        match self {
+            LogLevel::Trace => 0,
+            LogLevel::Debug => 1,
+            LogLevel::Info => 2,
+            LogLevel::Warning => 3,
+            LogLevel::Error => 4,
+        }
+    }
+}
+
 impl std::fmt::Display for LogLevel {
     fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
         match self {
@@ -75,57 +95,68 @@ impl From<LogLevel> for log::Level {
     }
 }
 
-pub(crate) struct Logger {
+struct Logger {
     callback: Box<Callback>,
-    level: LogLevel,
 }
 
 impl Logger {
     fn new(callback: Box<Callback>) -> Self {
-        Self {
-            callback,
-            level: LogLevel::Trace,
-        }
-    }
-
-    pub(crate) fn log(&self, level: LogLevel, message: &str) {
-        if level >= self.level {
-            (self.callback)(level, message);
-        }
+        Self { callback }
     }
 
-    fn level(&self) -> LogLevel {
-        self.level
+    fn log(&self, level: LogLevel, message: &str) {
+        (self.callback)(level, message);
     }
 
     fn set_callback(&mut self, callback: Box<Callback>) {
         self.callback = callback;
     }
-
-    fn set_level(&mut self, level: LogLevel) {
-        self.level = level;
-    }
 }
 
 #[clippy::format_args]
 macro_rules! log {
     ($level:expr, $($arg:tt)+) => {
-        // Log using the Rust log crate, as it's probably good to support that.
-        log::log!(log::Level::from($level), $($arg)+);
+        let level = $level;
 
-        // Also log using the callback.
-        let message = std::fmt::format(format_args!($($arg)+));
+        // Log using the Rust log crate, as it's probably good to support that.
+        log::log!(log::Level::from(level), $($arg)+);
 
-        match $crate::logging::LOGGER.read() {
-            Ok(logger) => logger.log($level, &message),
-            Err(e) => {
-                $crate::logging::LOGGER.clear_poison();
-                e.into_inner().log($level, &message);
-            }
+        // Also log using the callback, but only format the message if the
+        // callback would receive it.
+        if $crate::logging::is_callback_enabled(level) {
+            $crate::logging::log_to_callback(level, format_args!($($arg)+));
         }
     };
 }
 
+/// Check if a message at the given level would be passed to a callback that
+/// isn't the default no-op callback. This doesn't take the [LOGGER] lock.
+#[inline]
+pub(crate) fn is_callback_enabled(level: LogLevel) -> bool {
+    HAS_CALLBACK.load(Ordering::Relaxed) && level.as_u8() >= CALLBACK_LEVEL.load(Ordering::Relaxed)
+}
+
+/// Pass a message to the callback. This should only be called once
+/// [`is_callback_enabled`] has returned true for the message's level.
+pub(crate) fn log_to_callback(level: LogLevel, args: std::fmt::Arguments<'_>) {
+    // Messages without any arguments don't need to be formatted.
+    let formatted;
+    let message = if let Some(message) = args.as_str() {
+        message
+    } else {
+        formatted = std::fmt::format(args);
+        &formatted
+    };
+
+    match LOGGER.read() {
+        Ok(logger) => logger.log(level, message),
+        Err(e) => {
+            LOGGER.clear_poison();
+            e.into_inner().log(level, message);
+        }
+    }
+}
+
 #[clippy::format_args]
 macro_rules! error {
     ($($arg:tt)+) => { $crate::logging::log!(crate::LogLevel::Error, $($arg)+) };
@@ -152,19 +183,7 @@ macro_rules! trace {
 }
 
 pub(crate) fn is_log_enabled(level: LogLevel) -> bool {
-    if log::log_enabled!(level.into()) {
-        return true;
-    }
-
-    let logger = match LOGGER.read() {
-        Ok(logger) => logger,
-        Err(e) => {
-            LOGGER.clear_poison();
-            e.into_inner()
-        }
-    };
-
-    level >= logger.level()
+    log::log_enabled!(level.into()) || level.as_u8() >= CALLBACK_LEVEL.load(Ordering::Relaxed)
 }
 
 pub(crate) use {debug, error, info, log, trace, warning as warn};
@@ -311,6 +330,79 @@ mod tests {
         }
     }
 
+    mod log_macro {
+        use super::*;
+
+        use std::sync::atomic::AtomicUsize;
+
+        struct CountingDisplay<'a>(&'a AtomicUsize);
+
+        impl std::fmt::Display for CountingDisplay<'_> {
+            fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+                self.0.fetch_add(1, Ordering::Relaxed);
+                write!(f, "counted")
+            }
+        }
+
+        #[test]
+        fn should_not_format_messages_below_the_log_level() {
+            let _lock = TEST_LOCK.lock().unwrap();
+
+            let messages = Arc::new(Mutex::new(Vec::new()));
+            let cloned_messages = Arc::clone(&messages);
+            set_logging_callback(move |level, message: &str| {
+                if let Ok(mut messages) = cloned_messages.lock() {
+                    messages.push((level, message.to_owned()));
+                }
+            });
+            set_log_level(LogLevel::Warning);
+
+            let count = AtomicUsize::new(0);
+            trace!("Test trace {}", CountingDisplay(&count));
+            debug!("Test debug {}", CountingDisplay(&count));
+            info!("Test info {}", CountingDisplay(&count));
+
+            assert_eq!(0, count.load(Ordering::Relaxed));
+            assert!(messages.lock().unwrap().is_empty());
+
+            warning!("Test warning {}", CountingDisplay(&count));
+
+            assert_eq!(1, count.load(Ordering::Relaxed));
+            assert_eq!(
+                vec![(LogLevel::Warning, "Test warning counted".into())],
+                *messages.lock().unwrap()
+            );
+
+            set_log_level(LogLevel::Trace);
+        }
+
+        #[test]
+        fn should_pass_messages_with_and_without_arguments_to_the_callback() {
+            let _lock = TEST_LOCK.lock().unwrap();
+
+            let messages = Arc::new(Mutex::new(Vec::new()));
+            let cloned_messages = Arc::clone(&messages);
+            set_logging_callback(move |level, message: &str| {
+                if let Ok(mut messages) = cloned_messages.lock() {
+                    messages.push((level, message.to_owned()));
+                }
+            });
+            set_log_level(LogLevel::Trace);
+
+            let value = 5_u8;
+            trace!("Test message");
+            debug!("Test message {value}");
+
+            assert_eq!(
+                vec![
+                    (LogLevel::Trace, "Test message".into()),
+                    (LogLevel::Debug, "Test message 5".into())
+                ],
+                *messages.lock().unwrap()
+            );
+        }
+    }
+
     mod is_log_enabled {
         use super::*;
 
@@ -0,0 +1,348 @@
+use std::{
+    fs::{File, Metadata},
+    path::{Path, PathBuf},
+    sync::atomic::{AtomicU64, Ordering},
+    time::UNIX_EPOCH,
+};
+
+use rustc_hash::FxHashMap as HashMap;
+
+use crate::{escape_ascii, logging};
+
+const CACHE_FILENAME: &str = "plugin-crcs.txt";
+
+/// Used to give each temporary cache file written by this process a unique
+/// name, so that concurrent saves don't write to the same file.
+static NEXT_TEMP_FILE_ID: AtomicU64 = AtomicU64::new(0);
+
+/// Identifies a specific version of a file's content by its path, size and
+/// last modified time. Keys in a [`PersistentCrcCache`] use canonical paths.
+#[derive(Clone, Debug, Eq, Hash, Ord, PartialEq, PartialOrd)]
+pub(crate) struct FileKey {
+    path: PathBuf,
+    size: u64,
+    modified: u128,
+}
+
+impl FileKey {
+    /// Get the key for the file at the given path.
+    pub(crate) fn new(path: &Path) -> std::io::Result<Self> {
+        Self::with_metadata(path, &path.metadata()?)
+    }
+
+    /// Get the key for an open file, given the path that it was opened from.
+    pub(crate) fn from_file(path: &Path, file: &File) -> std::io::Result<Self> {
+        Self::with_metadata(path, &file.metadata()?)
+    }
+
+    /// Get the same key with the file's canonical path, as used in a
+    /// [`PersistentCrcCache`].
+    pub(crate) fn canonicalize(&self) -> std::io::Result<Self> {
+        Ok(Self {
+            path: std::fs::canonicalize(&self.path)?,
+            size: self.size,
+            modified: self.modified,
+        })
+    }
+
+    fn with_metadata(path: &Path, metadata: &Metadata) -> std::io::Result<Self> {
+        let modified = metadata
+            .modified()?
+            .duration_since(UNIX_EPOCH)
+            .map_err(std::io::Error::other)?
+            .as_nanos();
+
+        Ok(Self {
+            path: path.to_path_buf(),
+            size: metadata.len(),
+            modified,
+        })
+    }
+
+    pub(crate) fn path(&self) -> &Path {
+        &self.path
+    }
+}
+
+/// Plugin CRCs that are stored in a file in a cache directory so that they can
+/// be reused by later processes, as long as the plugin files have not changed.
+///
+/// The cache file records the version of libloot that wrote it, and its
+/// entries are ignored if they were written by a different version.
+#[derive(Debug, Default)]
+pub(crate) struct PersistentCrcCache {
+    crcs: HashMap<FileKey, u32>,
+}
+
+impl PersistentCrcCache {
+    /// Read the cache file in the given directory. If it does not exist or
+    /// can't be read, an empty cache is returned.
+    pub(crate) fn load(cache_directory: &Path) -> Self {
+        let cache_path = cache_directory.join(CACHE_FILENAME);
+        let content = match std::fs::read_to_string(&cache_path) {
+            Ok(c) => c,
+            Err(e) => {
+                if e.kind() != std::io::ErrorKind::NotFound {
+                    logging::warn!(
+                        "Could not read the plugin CRC cache at \"{}\": {}",
+                        escape_ascii(&cache_path),
+                        e
+                    );
+                }
+                return Self::default();
+            }
+        };
+
+        let mut lines = content.lines();
+        if lines.next() != Some(header().as_str()) {
+            logging::debug!(
+                "Ignoring the plugin CRC cache at \"{}\" as it was written by a different version of libloot",
+                escape_ascii(&cache_path)
+            );
+            return Self::default();
+        }
+
+        let crcs = lines.filter_map(parse_entry).collect();
+
+        Self { crcs }
+    }
+
+    pub(crate) fn get(&self, key: &FileKey) -> Option<u32> {
+        self.crcs.get(key).copied()
+    }
+
+    /// Insert a CRC into the cache, returning true if the cache has changed.
+    pub(crate) fn insert(&mut self, key: FileKey, crc: u32) -> bool {
+        self.crcs.insert(key, crc) != Some(crc)
+    }
+
+    /// Remove the entries for files that no longer exist or that have changed
+    /// since their CRCs were cached.
+    pub(crate) fn remove_stale_entries(&mut self) {
+        self.crcs
+            .retain(|key, _| FileKey::new(&key.path).is_ok_and(|current| current == *key));
+    }
+
+    /// Write the cache file in the given directory, replacing any existing
+    /// cache file.
+    pub(crate) fn save(&self, cache_directory: &Path) -> std::io::Result<()> {
+        let mut entries: Vec<_> = self
+            .crcs
+            .iter()
+            .filter_map(|(key, crc)| key.path.to_str().map(|p| (p, key, crc)))
+            .filter(|(path, _, _)| !path.contains(['\n', '\r']))
+            .collect();
+        entries.sort_unstable_by_key(|(path, _, _)| *path);
+
+        let content: String = std::iter::once(header())
+            .chain(entries.into_iter().map(|(path, key, crc)| {
+                format!("{}\t{}\t{:08X}\t{}", key.size, key.modified, crc, path)
+            }))
+            .map(|line| line + "\n")
+            .collect();
+
+        std::fs::create_dir_all(cache_directory)?;
+
+        // Write to a temporary file and then rename it so that other processes
+        // never see a partially-written cache file. If more than one process
+        // saves the cache at the same time, the last one to rename its file
+        // wins.
+        let cache_path = cache_directory.join(CACHE_FILENAME);
+        let temp_path = cache_directory.join(format!(
+            "{CACHE_FILENAME}.{}.{}.tmp",
+            std::process::id(),
+            NEXT_TEMP_FILE_ID.fetch_add(1, Ordering::Relaxed)
+        ));
+
+        let result = std::fs::write(&temp_path, content)
+            .and_then(|()| std::fs::rename(&temp_path, cache_path));
+
+        if result.is_err()
+            && let Err(e) = std::fs::remove_file(&temp_path)
+        {
+            logging::debug!(
+                "Could not remove the temporary plugin CRC cache file at \"{}\": {}",
+                escape_ascii(&temp_path),
+                e
+            );
+        }
+
+        result
+    }
+}
+
+fn header() -> String {
+    format!("libloot {}", env!("CARGO_PKG_VERSION"))
+}
+
+fn parse_entry(line: &str) -> Option<(FileKey, u32)> {
+    let mut fields = line.splitn(4, '\t');
+    let size = fields.next()?.parse().ok()?;
+    let modified = fields.next()?.parse().ok()?;
+    let crc = u32::from_str_radix(fields.next()?, 16).ok()?;
+    let path = PathBuf::from(fields.next()?);
+
+    Some((
+        FileKey {
+            path,
+            size,
+            modified,
+        },
+        crc,
+    ))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    use tempfile::tempdir;
+
+    #[test]
+    fn load_should_return_an_empty_cache_if_the_cache_file_does_not_exist() {
+        let tmp_dir = tempdir().unwrap();
+
+        let cache = PersistentCrcCache::load(tmp_dir.path());
+
+        assert!(cache.crcs.is_empty());
+    }
+
+    #[test]
+    fn load_should_read_entries_written_by_save() {
+        let tmp_dir = tempdir().unwrap();
+        let file_path = tmp_dir.path().join("Blank.esm");
+        std::fs::write(&file_path, "content").unwrap();
+        let cache_directory = tmp_dir.path().join("cache");
+
+        let key = FileKey::new(&file_path).unwrap();
+        let mut cache = PersistentCrcCache::default();
+        cache.insert(key.clone(), 0xDEAD_BEEF);
+        cache.save(&cache_directory).unwrap();
+
+        let cache = PersistentCrcCache::load(&cache_directory);
+
+        assert_eq!(Some(0xDEAD_BEEF), cache.get(&key));
+    }
+
+    #[test]
+    fn load_should_ignore_a_cache_file_written_by_a_different_version() {
+        let tmp_dir = tempdir().unwrap();
+        let file_path = tmp_dir.path().join("Blank.esm");
+        std::fs::write(&file_path, "content").unwrap();
+
+        let key = FileKey::new(&file_path).unwrap();
+        let mut cache = PersistentCrcCache::default();
+        cache.insert(key.clone(), 0xDEAD_BEEF);
+        cache.save(tmp_dir.path()).unwrap();
+
+        let cache_path = tmp_dir.path().join(CACHE_FILENAME);
+        let content = std::fs::read_to_string(&cache_path)
+            .unwrap()
+            .replace(&header(), "libloot 0.0.0");
+        std::fs::write(&cache_path, content).unwrap();
+
+        let cache = PersistentCrcCache::load(tmp_dir.path());
+
+        assert!(cache.get(&key).is_none());
+    }
+
+    #[test]
+    fn insert_should_return_whether_the_cache_has_changed() {
+        let tmp_dir = tempdir().unwrap();
+        let file_path = tmp_dir.path().join("Blank.esm");
+        std::fs::write(&file_path, "content").unwrap();
+
+        let key = FileKey::new(&file_path).unwrap();
+        let mut cache = PersistentCrcCache::default();
+
+        assert!(cache.insert(key.clone(), 0xDEAD_BEEF));
+        assert!(!cache.insert(key.clone(), 0xDEAD_BEEF));
+        assert!(cache.insert(key, 0x1234_5678));
+    }
+
+    #[test]
+    fn remove_stale_entries_should_remove_entries_for_missing_and_changed_files() {
+        let tmp_dir = tempdir().unwrap();
+        let unchanged_path = tmp_dir.path().join("Blank.esm");
+        let changed_path = tmp_dir.path().join("Blank.esp");
+        let removed_path = tmp_dir.path().join("Blank - Different.esm");
+        for path in [&unchanged_path, &changed_path, &removed_path] {
+            std::fs::write(path, "content").unwrap();
+        }
+
+        let unchanged_key = FileKey::new(&unchanged_path).unwrap();
+        let changed_key = FileKey::new(&changed_path).unwrap();
+        let removed_key = FileKey::new(&removed_path).unwrap();
+
+        let mut cache = PersistentCrcCache::default();
+        cache.insert(unchanged_key.clone(), 1);
+        cache.insert(changed_key.clone(), 2);
+        cache.insert(removed_key.clone(), 3);
+
+        std::fs::write(&changed_path, "changed content").unwrap();
+        std::fs::remove_file(&removed_path).unwrap();
+
+        cache.remove_stale_entries();
+
+        assert_eq!(Some(1), cache.get(&unchanged_key));
+        assert!(cache.get(&changed_key).is_none());
+        assert!(cache.get(&removed_key).is_none());
+    }
+
+    #[test]
+    fn save_should_not_leave_a_temporary_file_behind() {
+        let tmp_dir = tempdir().unwrap();
+
+        PersistentCrcCache::default().save(tmp_dir.path()).unwrap();
+
+        let filenames: Vec<_> = std::fs::read_dir(tmp_dir.path())
+            .unwrap()
+            .map(|e| e.unwrap().file_name())
+            .collect();
+        assert_eq!(vec![CACHE_FILENAME], filenames);
+    }
+
+    #[test]
+    fn file_key_from_file_should_equal_the_key_from_the_file_path() {
+        let tmp_dir = tempdir().unwrap();
+        let file_path = tmp_dir.path().join("Blank.esm");
+        std::fs::write(&file_path, "content").unwrap();
+
+        let file = File::open(&file_path).unwrap();
+
+        assert_eq!(
+            FileKey::new(&file_path).unwrap(),
+            FileKey::from_file(&file_path, &file).unwrap()
+        );
+    }
+
+    #[test]
+    fn file_key_canonicalize_should_only_change_the_path() {
+        let tmp_dir = tempdir().unwrap();
+        let file_path = tmp_dir.path().join("Blank.esm");
+        std::fs::write(&file_path, "content").unwrap();
+
+        let key = FileKey::new(&tmp_dir.path().join(".").join("Blank.esm")).unwrap();
+        let canonical_key = key.canonicalize().unwrap();
+
+        assert_eq!(
+            std::fs::canonicalize(&file_path).unwrap(),
+            canonical_key.path
+        );
+        assert_eq!(key.size, canonical_key.size);
+        assert_eq!(key.modified, canonical_key.modified);
+    }
+
+    #[test]
+    fn file_key_should_change_if_the_file_size_changes() {
+        let tmp_dir = tempdir().unwrap();
+        let file_path = tmp_dir.path().join("Blank.esm");
+        std::fs::write(&file_path, "content").unwrap();
+
+        let key = FileKey::new(&file_path).unwrap();
+
+        std::fs::write(&file_path, "changed content").unwrap();
+
+        assert_ne!(key, FileKey::new(&file_path).unwrap());
+    }
+}
@@ -1,12 +1,17 @@
+pub(crate) mod crc_cache;
 pub(crate) mod error;
+mod record_overlaps;
 
 use std::{
-    collections::{BTreeMap, BTreeSet},
+    collections::HashSet,
     fs::File,
     hash::Hasher,
-    io::{BufRead, BufReader},
+    io::{BufRead, BufReader, Cursor, Read},
     path::{Path, PathBuf},
-    sync::LazyLock,
+    sync::{
+        Arc, LazyLock, OnceLock,
+        atomic::{AtomicU64, Ordering},
+    },
 };
 
 use esplugin::ParseOptions;
@@ -14,16 +19,18 @@ use regress::Regex;
 
 use crate::{
     GameType,
-    archive::{assets_in_archives, do_assets_overlap, find_associated_archives},
+    archive::{ArchiveAssets, assets_in_archives, do_assets_overlap},
     case_insensitive_regex, escape_ascii,
     game::GameCache,
     logging,
     metadata::plugin_metadata::trim_dot_ghost,
 };
+use crc_cache::FileKey;
 use error::{
     InvalidFilenameReason, LoadPluginError, PluginDataError, PluginValidationError,
     PluginValidationErrorReason,
 };
+use record_overlaps::RecordOverlapCache;
 
 #[derive(Clone, Copy, Debug, Eq, PartialEq, Ord, PartialOrd, Hash)]
 pub(crate) enum LoadScope {
@@ -40,70 +47,145 @@ impl std::fmt::Display for LoadScope {
     }
 }
 
+/// How a plugin file's contents are read when it is loaded.
+#[derive(Clone, Copy, Debug, Default, Eq, PartialEq)]
+pub(crate) enum ReadMode {
+    #[default]
+    Buffered,
+    /// Read the whole file into memory and calculate the plugin's CRC from it
+    /// when fully loading the plugin, for use when the CRC is known to be
+    /// needed, so that the file is only read once.
+    BufferedWithCrc,
+    /// Memory-map the file, falling back to buffered reads if that fails.
+    MemoryMapped,
+}
+
+/// Used to give each loaded plugin a unique ID, so that cached results of
+/// comparisons with other plugins can't be confused with results for a plugin
+/// that has since been reloaded.
+static NEXT_PLUGIN_ID: AtomicU64 = AtomicU64::new(0);
+
+fn next_plugin_id() -> u64 {
+    NEXT_PLUGIN_ID.fetch_add(1, Ordering::Relaxed)
+}
+
 /// Represents a plugin file that has been loaded.
-#[derive(Clone, Debug, Eq, PartialEq)]
+#[derive(Clone, Debug)]
 pub struct Plugin {
+    id: u64,
     name: String,
     data: Option<esplugin::Plugin>,
     game_type: GameType,
-    crc: Option<u32>,
+    /// The file to calculate the plugin's CRC from, as it was when the plugin
+    /// was loaded, if the plugin was fully loaded.
+    crc_file: Option<FileKey>,
+    /// The plugin's CRC, which is calculated the first time that it's needed.
+    crc: OnceLock<u32>,
     version: Option<String>,
     tags: Box<[String]>,
     archive_paths: Box<[PathBuf]>,
-    archive_assets: BTreeMap<u64, BTreeSet<u64>>,
+    archive_assets: Arc<ArchiveAssets>,
+    record_overlaps: RecordOverlapCache,
 }
 
 impl Plugin {
+    #[cfg(test)]
     pub(crate) fn new(
         game_type: GameType,
         game_cache: &GameCache,
         plugin_path: &Path,
         load_scope: LoadScope,
+        read_mode: ReadMode,
+    ) -> Result<Self, LoadPluginError> {
+        let mut plugin = Self::load(game_type, plugin_path, load_scope, read_mode)?;
+
+        if plugin.can_load_archives() {
+            plugin.set_archive_paths(crate::archive::find_associated_archives(
+                game_type,
+                game_cache,
+                plugin_path,
+            ));
+
+            if load_scope == LoadScope::WholePlugin {
+                plugin.load_archive_assets(game_cache);
+            }
+        }
+
+        Ok(plugin)
+    }
+
+    /// Load a plugin without the archives that it loads, which can be added
+    /// using [`Plugin::set_archive_paths`] and
+    /// [`Plugin::load_archive_assets`].
+    pub(crate) fn load(
+        game_type: GameType,
+        plugin_path: &Path,
+        load_scope: LoadScope,
+        read_mode: ReadMode,
     ) -> Result<Self, LoadPluginError> {
         let name = name_string(game_type, plugin_path)?;
 
-        let (parse_options, crc) = if load_scope == LoadScope::HeaderOnly {
-            (ParseOptions::header_only(), None)
+        let parse_options = if load_scope == LoadScope::HeaderOnly {
+            ParseOptions::header_only()
         } else {
-            let crc = calculate_crc(plugin_path)?;
-            (ParseOptions::whole_plugin(), Some(crc))
+            ParseOptions::whole_plugin()
         };
 
         let mut version = None;
         let mut tags = Box::default();
-        let mut archive_paths = Box::default();
-        let mut archive_assets = BTreeMap::new();
-        let plugin =
-            if game_type != GameType::OpenMW || !has_ascii_extension(plugin_path, "omwscripts") {
-                let mut plugin = esplugin::Plugin::new(game_type.into(), plugin_path);
-                plugin.parse_file(parse_options)?;
-
-                if let Some(description) = plugin.description()? {
-                    tags = extract_bash_tags(&description).into_boxed_slice();
-                    version = extract_version(&description);
-                }
-
-                archive_paths =
-                    find_associated_archives(game_type, game_cache, plugin_path).into_boxed_slice();
+        let mut crc_file = None;
+        let mut crc = OnceLock::new();
+        let plugin = if game_type != GameType::OpenMW
+            || !has_ascii_extension(plugin_path, "omwscripts")
+        {
+            let mut file = File::open(plugin_path)?;
 
-                if load_scope == LoadScope::WholePlugin {
-                    archive_assets = assets_in_archives(&archive_paths);
-                }
+            // Record the file's size and modification time before reading
+            // it, so that a lazily-calculated CRC can be checked against the
+            // file that was parsed.
+            if load_scope == LoadScope::WholePlugin {
+                crc_file = file_key(plugin_path, FileKey::from_file(plugin_path, &file));
+            }
 
-                Some(plugin)
+            let mut plugin = esplugin::Plugin::new(game_type.into(), plugin_path);
+            if let Some(map) = memory_map_if_enabled(plugin_path, &file, load_scope, read_mode) {
+                plugin.parse_reader(Cursor::new(&*map), parse_options)?;
+            } else if load_scope == LoadScope::WholePlugin && read_mode == ReadMode::BufferedWithCrc
+            {
+                let mut bytes = Vec::new();
+                file.read_to_end(&mut bytes)?;
+                crc = OnceLock::from(crc32fast::hash(&bytes));
+                plugin.parse_reader(Cursor::new(bytes), parse_options)?;
             } else {
-                None
-            };
+                plugin.parse_reader(BufReader::new(file), parse_options)?;
+            }
+
+            if let Some(description) = plugin.description()? {
+                tags = extract_bash_tags(&description).into_boxed_slice();
+                version = extract_version(&description);
+            }
+
+            Some(plugin)
+        } else {
+            if load_scope == LoadScope::WholePlugin {
+                crc_file = file_key(plugin_path, FileKey::new(plugin_path));
+            }
+
+            None
+        };
 
         Ok(Self {
+            id: next_plugin_id(),
             name,
             data: plugin,
             game_type,
+            crc_file,
             crc,
             version,
             tags,
-            archive_paths,
-            archive_assets,
+            archive_paths: Box::default(),
+            archive_assets: Arc::default(),
+            record_overlaps: RecordOverlapCache::default(),
         })
     }
 
@@ -152,9 +234,49 @@ impl Plugin {
 
     /// Get the plugin's CRC-32 checksum.
     ///
-    /// This will be `None` if the plugin is not fully loaded.
+    /// This will be `None` if the plugin is not fully loaded, or if its CRC
+    /// could not be calculated. If the CRC was known to be needed when the
+    /// plugin was loaded, it was calculated from the data that was parsed,
+    /// otherwise it is calculated from the plugin file the first time that
+    /// it's needed. Either way, it is then reused.
+    ///
+    /// The CRC is not calculated if the plugin file's size or modification
+    /// time has changed since the plugin was loaded, as the file's content
+    /// may no longer match the loaded data, so `None` is returned instead.
     pub fn crc(&self) -> Option<u32> {
-        self.crc
+        if let Some(crc) = self.crc.get() {
+            return Some(*crc);
+        }
+
+        let file = self.crc_file.as_ref()?;
+        match calculate_crc(file) {
+            Ok(crc) => Some(*self.crc.get_or_init(|| crc)),
+            Err(e) => {
+                logging::error!(
+                    "Could not calculate the CRC of \"{}\": {}",
+                    escape_ascii(file.path()),
+                    e
+                );
+                None
+            }
+        }
+    }
+
+    /// Get the plugin's CRC-32 checksum if it has already been calculated.
+    pub(crate) fn calculated_crc(&self) -> Option<u32> {
+        self.crc.get().copied()
+    }
+
+    /// Get the identity of the file that the plugin's CRC is calculated from,
+    /// as it was when the plugin was loaded, if the plugin was fully loaded.
+    pub(crate) fn crc_file(&self) -> Option<&FileKey> {
+        self.crc_file.as_ref()
+    }
+
+    /// Set the plugin's CRC-32 checksum to a value that was calculated
+    /// elsewhere, if it has not already been calculated.
+    pub(crate) fn set_calculated_crc(&self, crc: u32) {
+        self.crc.get_or_init(|| crc);
     }
 
     /// Check if the plugin is a master plugin.
@@ -246,18 +368,67 @@ impl Plugin {
         !self.archive_paths.is_empty()
     }
 
+    pub(crate) fn archive_paths(&self) -> &[PathBuf] {
+        &self.archive_paths
+    }
+
+    /// Check if the plugin can load archives, which only plugins that are
+    /// parsed can do.
+    pub(crate) fn can_load_archives(&self) -> bool {
+        self.data.is_some()
+    }
+
+    /// Set the paths of the archives that the plugin loads.
+    pub(crate) fn set_archive_paths(&mut self, archive_paths: Vec<PathBuf>) {
+        self.archive_paths = archive_paths.into_boxed_slice();
+    }
+
+    /// Get the assets in the archives that the plugin loads, using the game
+    /// cache's archive index for any archives that it holds.
+    pub(crate) fn load_archive_assets(&mut self, game_cache: &GameCache) {
+        self.archive_assets = assets_in_archives(&self.archive_paths, game_cache);
+    }
+
     /// Check if two plugins contain a record with the same ID.
     ///
     /// FormIDs are compared for all games apart from Morrowind, which doesn't
     /// have FormIDs and so has other identifying data compared.
+    ///
+    /// The result is cached, so checking the same two plugins again is
+    /// usually cheap.
     pub fn do_records_overlap(&self, plugin: &Plugin) -> Result<bool, PluginDataError> {
-        if let (Some(plugin), Some(other_plugin)) = (&self.data, &plugin.data) {
-            plugin.overlaps_with(other_plugin).map_err(Into::into)
+        if let (Some(data), Some(other_data)) = (&self.data, &plugin.data) {
+            if let Some(overlap) = self
+                .record_overlaps
+                .get(plugin.id)
+                .or_else(|| plugin.record_overlaps.get(self.id))
+            {
+                return Ok(overlap);
+            }
+
+            let overlap = data.overlaps_with(other_data)?;
+
+            self.record_overlaps.insert(plugin.id, overlap);
+
+            Ok(overlap)
         } else {
             Ok(false)
         }
     }
 
+    /// Forget the cached record overlaps for plugins that don't have one of
+    /// the given IDs, so that plugins that have been replaced don't take up
+    /// space in the cache.
+    pub(crate) fn retain_record_overlaps(&self, plugin_ids: &HashSet<u64>) {
+        self.record_overlaps.retain(plugin_ids);
+    }
+
+    /// Get an ID that identifies this plugin's loaded data, so it changes if
+    /// the plugin is loaded again.
+    pub(crate) fn id(&self) -> u64 {
+        self.id
+    }
+
     pub(crate) fn override_record_count(&self) -> Result<usize, PluginDataError> {
         self.data
             .as_ref()
@@ -278,11 +449,41 @@ impl Plugin {
     ) -> Result<(), PluginDataError> {
         if let Some(plugin) = &mut self.data {
             plugin.resolve_record_ids(plugins_metadata)?;
+
+            // The plugin's record IDs may have changed, so treat it as a
+            // different plugin when comparing it with other plugins.
+            self.id = next_plugin_id();
+            self.record_overlaps.clear();
         }
         Ok(())
     }
 }
 
+// PartialEq is implemented manually because the plugin's ID and cached record
+// overlaps identify the loaded data rather than being part of it, and its CRC
+// is only calculated when it's needed. Plugins are only equal if they were
+// fully loaded from the same file with the same size and modification time
+// (or neither was fully loaded), and their CRCs are only compared if both
+// have been calculated.
+impl PartialEq for Plugin {
+    fn eq(&self, other: &Self) -> bool {
+        self.name == other.name
+            && self.data == other.data
+            && self.game_type == other.game_type
+            && self.crc_file == other.crc_file
+            && match (self.crc.get(), other.crc.get()) {
+                (Some(crc), Some(other_crc)) => crc == other_crc,
+                _ => true,
+            }
+            && self.version == other.version
+            && self.tags == other.tags
+            && self.archive_paths == other.archive_paths
+            && self.archive_assets == other.archive_assets
+    }
+}
+
+impl Eq for Plugin {}
+
 pub(crate) fn validate_plugin_path_and_header(
     game_type: GameType,
     plugin_path: &Path,
@@ -373,7 +574,83 @@ fn name_string(game_type: GameType, path: &Path) -> Result<String, LoadPluginErr
     }
 }
 
-fn calculate_crc(path: &Path) -> std::io::Result<u32> {
+/// Memory-map the plugin file at the given path if the given read mode
+/// requires it. Only whole plugins are mapped, as reading just a plugin's
+/// header touches too little of the file to benefit. Returns `None` if the file
+/// should be parsed using buffered reads.
+fn memory_map_if_enabled(
+    path: &Path,
+    file: &File,
+    load_scope: LoadScope,
+    read_mode: ReadMode,
+) -> Option<memmap2::Mmap> {
+    if load_scope != LoadScope::WholePlugin || read_mode != ReadMode::MemoryMapped {
+        return None;
+    }
+
+    match memory_map(file) {
+        Ok(map) => Some(map),
+        Err(e) => {
+            logging::debug!(
+                "Could not memory-map \"{}\", falling back to buffered reads: {}",
+                escape_ascii(path),
+                e
+            );
+            None
+        }
+    }
+}
+
+fn memory_map(file: &File) -> std::io::Result<memmap2::Mmap> {
+    // SAFETY: The map is only read from while the plugin is being loaded, and
+    // is dropped before Plugin::load() returns. The file could still be
+    // modified or truncated by another process in that time, which is why
+    // memory-mapped loading is opt-in.
+    #[expect(
+        unsafe_code,
+        reason = "There is currently no way to memory-map a file safely"
+    )]
+    unsafe {
+        memmap2::Mmap::map(file)
+    }
+}
+
+fn file_key(path: &Path, key: std::io::Result<FileKey>) -> Option<FileKey> {
+    match key {
+        Ok(key) => Some(key),
+        Err(e) => {
+            logging::debug!(
+                "Could not read the metadata of \"{}\", so its CRC will not be calculated: {}",
+                escape_ascii(path),
+                e
+            );
+            None
+        }
+    }
+}
+
+fn calculate_crc(file: &FileKey) -> std::io::Result<u32> {
+    check_file_is_unchanged(file)?;
+
+    let crc = hash_file(file.path())?;
+
+    // Check again in case the file was written to while it was being read.
+    check_file_is_unchanged(file)?;
+
+    Ok(crc)
+}
+
+fn check_file_is_unchanged(file: &FileKey) -> std::io::Result<()> {
+    if FileKey::new(file.path())? == *file {
+        Ok(())
+    } else {
+        Err(std::io::Error::other(
+            "the file has changed since the plugin was loaded",
+        ))
+    }
+}
+
+fn hash_file(path: &Path) -> std::io::Result<u32> {
     let file = File::open(path)?;
     let mut reader = BufReader::new(file);
     let mut hasher = crc32fast::Hasher::new();
@@ -509,6 +786,7 @@ mod tests {
                 &GameCache::default(),
                 &ghosted_path,
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -538,6 +816,7 @@ mod tests {
                 &GameCache::default(),
                 &path,
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -583,6 +862,7 @@ mod tests {
                 &GameCache::default(),
                 &path,
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -598,6 +878,7 @@ mod tests {
                 &GameCache::default(),
                 &path,
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -605,6 +886,134 @@ mod tests {
             assert_eq!(0, plugin.asset_count());
         }
 
+        #[test]
+        fn crc_should_be_calculated_when_first_needed_and_then_reused() {
+            let game_type = GameType::Oblivion;
+            let tmp_dir = tempdir().unwrap();
+            let path = tmp_dir.path().join(BLANK_ESM);
+            std::fs::copy(source_plugins_path(game_type).join(BLANK_ESM), &path).unwrap();
+
+            let plugin = Plugin::new(
+                game_type,
+                &GameCache::default(),
+                &path,
+                LoadScope::WholePlugin,
+                ReadMode::Buffered,
+            )
+            .unwrap();
+
+            assert!(plugin.calculated_crc().is_none());
+
+            let crc = plugin.crc().unwrap();
+            assert_eq!(Some(crc), plugin.calculated_crc());
+
+            std::fs::remove_file(&path).unwrap();
+
+            assert_eq!(Some(crc), plugin.crc());
+        }
+
+        #[test]
+        fn crc_should_be_none_if_the_plugin_file_has_changed_since_it_was_loaded() {
+            let game_type = GameType::Oblivion;
+            let tmp_dir = tempdir().unwrap();
+            let path = tmp_dir.path().join(BLANK_ESM);
+            std::fs::copy(source_plugins_path(game_type).join(BLANK_ESM), &path).unwrap();
+
+            let plugin = Plugin::new(
+                game_type,
+                &GameCache::default(),
+                &path,
+                LoadScope::WholePlugin,
+                ReadMode::Buffered,
+            )
+            .unwrap();
+
+            let mut file = File::options().append(true).open(&path).unwrap();
+            file.write_all(b"appended").unwrap();
+
+            assert!(plugin.crc().is_none());
+            assert!(plugin.calculated_crc().is_none());
+        }
+
+        #[test]
+        fn new_with_buffered_with_crc_read_mode_should_calculate_the_crc_of_a_whole_plugin() {
+            let game_type = GameType::Oblivion;
+            let path = source_plugins_path(game_type).join(BLANK_ESM);
+
+            let plugin = Plugin::new(
+                game_type,
+                &GameCache::default(),
+                &path,
+                LoadScope::WholePlugin,
+                ReadMode::BufferedWithCrc,
+            )
+            .unwrap();
+
+            let expected_crc = crc32fast::hash(&std::fs::read(&path).unwrap());
+            assert_eq!(Some(expected_crc), plugin.calculated_crc());
+
+            let plugin = Plugin::new(
+                game_type,
+                &GameCache::default(),
+                &path,
+                LoadScope::HeaderOnly,
+                ReadMode::BufferedWithCrc,
+            )
+            .unwrap();
+
+            assert!(plugin.calculated_crc().is_none());
+        }
+
+        #[test]
+        fn new_with_memory_mapped_read_mode_should_not_calculate_the_crc() {
+            let game_type = GameType::Oblivion;
+            let path = source_plugins_path(game_type).join(BLANK_ESM);
+
+            let plugin = Plugin::new(
+                game_type,
+                &GameCache::default(),
+                &path,
+                LoadScope::WholePlugin,
+                ReadMode::MemoryMapped,
+            )
+            .unwrap();
+
+            assert!(plugin.calculated_crc().is_none());
+
+            let expected_crc = crc32fast::hash(&std::fs::read(&path).unwrap());
+            assert_eq!(Some(expected_crc), plugin.crc());
+        }
+
+        #[parameterized_test(ALL_GAME_TYPES)]
+        fn new_with_any_read_mode_should_read_the_same_data_as_buffered_reads(game_type: GameType) {
+            let path = source_plugins_path(game_type).join(blank_master_dependent_esm(game_type));
+
+            for load_scope in [LoadScope::HeaderOnly, LoadScope::WholePlugin] {
+                let buffered = Plugin::new(
+                    game_type,
+                    &GameCache::default(),
+                    &path,
+                    load_scope,
+                    ReadMode::Buffered,
+                )
+                .unwrap();
+
+                for read_mode in [ReadMode::BufferedWithCrc, ReadMode::MemoryMapped] {
+                    let plugin = Plugin::new(
+                        game_type,
+                        &GameCache::default(),
+                        &path,
+                        load_scope,
+                        read_mode,
+                    )
+                    .unwrap();
+
+                    assert_eq!(buffered, plugin);
+                    assert_eq!(buffered.crc(), plugin.crc());
+                }
+            }
+        }
+
         #[parameterized_test(ALL_GAME_TYPES)]
         fn new_with_whole_plugin_scope_should_read_records(game_type: GameType) {
             let plugin_name = blank_master_dependent_esm(game_type);
@@ -615,6 +1024,7 @@ mod tests {
                 &GameCache::default(),
                 &path,
                 LoadScope::WholePlugin,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -659,6 +1069,7 @@ mod tests {
                     &GameCache::default(),
                     &source_plugins_path(game_type).join(BLANK_ESM),
                     LoadScope::WholePlugin,
+                    ReadMode::Buffered,
                 )
                 .unwrap();
 
@@ -673,6 +1084,7 @@ mod tests {
                     &GameCache::default(),
                     &source_plugins_path(game_type).join(BLANK_FULL_ESM),
                     LoadScope::WholePlugin,
+                    ReadMode::Buffered,
                 )
                 .unwrap();
 
@@ -698,7 +1110,14 @@ mod tests {
                 data_path.join("Blank - Main.ba2"),
             ]);
 
-            let plugin = Plugin::new(game_type, &cache, &path, LoadScope::WholePlugin).unwrap();
+            let plugin = Plugin::new(
+                game_type,
+                &cache,
+                &path,
+                LoadScope::WholePlugin,
+                ReadMode::Buffered,
+            )
+            .unwrap();
 
             if matches!(
                 game_type,
@@ -733,7 +1152,8 @@ mod tests {
                     game_type,
                     &GameCache::default(),
                     &omwgame,
-                    LoadScope::WholePlugin
+                    LoadScope::WholePlugin,
+                    ReadMode::Buffered
                 )
                 .is_ok()
             );
@@ -742,7 +1162,8 @@ mod tests {
                     game_type,
                     &GameCache::default(),
                     &omwaddon,
-                    LoadScope::WholePlugin
+                    LoadScope::WholePlugin,
+                    ReadMode::Buffered
                 )
                 .is_ok()
             );
@@ -753,7 +1174,8 @@ mod tests {
                     game_type,
                     &GameCache::default(),
                     &omwscripts,
-                    LoadScope::WholePlugin
+                    LoadScope::WholePlugin,
+                    ReadMode::Buffered
                 )
                 .is_ok()
             );
@@ -769,12 +1191,96 @@ mod tests {
                     GameType::Oblivion,
                     &GameCache::default(),
                     path,
-                    LoadScope::HeaderOnly
+                    LoadScope::HeaderOnly,
+                    ReadMode::Buffered
                 )
                 .is_err()
             );
         }
 
+        #[test]
+        fn do_records_overlap_should_cache_the_result_for_the_pair_of_plugins() {
+            let game_type = GameType::SkyrimSE;
+            let load = |name| {
+                Plugin::new(
+                    game_type,
+                    &GameCache::default(),
+                    &source_plugins_path(game_type).join(name),
+                    LoadScope::WholePlugin,
+                    ReadMode::Buffered,
+                )
+                .unwrap()
+            };
+            let master = load(BLANK_ESM);
+            let dependent = load(BLANK_MASTER_DEPENDENT_ESM);
+            let other = load(BLANK_ESP);
+
+            assert!(master.record_overlaps.get(dependent.id).is_none());
+
+            assert!(master.do_records_overlap(&dependent).unwrap());
+            assert!(!master.do_records_overlap(&other).unwrap());
+
+            assert_eq!(Some(true), master.record_overlaps.get(dependent.id));
+            assert_eq!(Some(false), master.record_overlaps.get(other.id));
+            assert!(dependent.record_overlaps.get(master.id).is_none());
+
+            assert!(dependent.do_records_overlap(&master).unwrap());
+            assert!(!other.do_records_overlap(&master).unwrap());
+        }
+
+        #[test]
+        fn retain_record_overlaps_should_forget_overlaps_with_plugins_without_the_given_ids() {
+            let game_type = GameType::SkyrimSE;
+            let load = |name| {
+                Plugin::new(
+                    game_type,
+                    &GameCache::default(),
+                    &source_plugins_path(game_type).join(name),
+                    LoadScope::WholePlugin,
+                    ReadMode::Buffered,
+                )
+                .unwrap()
+            };
+            let master = load(BLANK_ESM);
+            let dependent = load(BLANK_MASTER_DEPENDENT_ESM);
+            let other = load(BLANK_ESP);
+
+            assert!(master.do_records_overlap(&dependent).unwrap());
+            assert!(!master.do_records_overlap(&other).unwrap());
+
+            master.retain_record_overlaps(&HashSet::from([master.id, dependent.id]));
+
+            assert_eq!(Some(true), master.record_overlaps.get(dependent.id));
+            assert!(master.record_overlaps.get(other.id).is_none());
+        }
+
+        #[test]
+        fn clone_should_be_equal_to_the_original_and_keep_its_cached_record_overlaps() {
+            let game_type = GameType::SkyrimSE;
+            let load = |name| {
+                Plugin::new(
+                    game_type,
+                    &GameCache::default(),
+                    &source_plugins_path(game_type).join(name),
+                    LoadScope::WholePlugin,
+                    ReadMode::Buffered,
+                )
+                .unwrap()
+            };
+            let master = load(BLANK_ESM);
+            let dependent = load(BLANK_MASTER_DEPENDENT_ESM);
+
+            let clone = master.clone();
+            assert_eq!(master, clone);
+
+            assert!(master.do_records_overlap(&dependent).unwrap());
+
+            let clone = master.clone();
+            assert_eq!(master, clone);
+            assert_eq!(Some(true), clone.record_overlaps.get(dependent.id));
+            assert_ne!(master, dependent);
+        }
+
         #[parameterized_test(ALL_GAME_TYPES)]
         fn is_master_should_be_false_for_a_non_master_plugin(game_type: GameType) {
             let path = source_plugins_path(game_type).join(BLANK_ESP);
@@ -783,6 +1289,7 @@ mod tests {
                 &GameCache::default(),
                 &path,
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -804,6 +1311,7 @@ mod tests {
                 &GameCache::default(),
                 &data_path.join(blank_esm(game_type)),
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
             let plugin = Plugin::new(
@@ -811,6 +1319,7 @@ mod tests {
                 &GameCache::default(),
                 &data_path.join(BLANK_ESP),
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
             let light = Plugin::new(
@@ -818,6 +1327,7 @@ mod tests {
                 &GameCache::default(),
                 &light_path,
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -861,6 +1371,7 @@ mod tests {
                 &GameCache::default(),
                 &data_path.join(blank_esm(game_type)),
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
             let plugin = Plugin::new(
@@ -868,6 +1379,7 @@ mod tests {
                 &GameCache::default(),
                 &path,
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -897,6 +1409,7 @@ mod tests {
                 &GameCache::default(),
                 &source_plugins_path(game_type).join(BLANK_ESP),
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
             let update = Plugin::new(
@@ -904,6 +1417,7 @@ mod tests {
                 &GameCache::default(),
                 &path,
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -927,6 +1441,7 @@ mod tests {
                 &GameCache::default(),
                 &source_plugins_path(game_type).join(BLANK_ESP),
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
             let update = Plugin::new(
@@ -934,6 +1449,7 @@ mod tests {
                 &GameCache::default(),
                 &data_path.join(blueprint_plugin_name),
                 LoadScope::HeaderOnly,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -951,6 +1467,7 @@ mod tests {
                 &GameCache::default(),
                 &path,
                 LoadScope::WholePlugin,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -960,6 +1477,7 @@ mod tests {
                     &GameCache::default(),
                     &source_plugins_path(game_type).join(BLANK_FULL_ESM),
                     LoadScope::WholePlugin,
+                    ReadMode::Buffered,
                 )
                 .unwrap();
 
@@ -994,6 +1512,7 @@ mod tests {
                 &GameCache::default(),
                 &path,
                 LoadScope::WholePlugin,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -1003,6 +1522,7 @@ mod tests {
                     &GameCache::default(),
                     &source_plugins_path(game_type).join(BLANK_FULL_ESM),
                     LoadScope::WholePlugin,
+                    ReadMode::Buffered,
                 )
                 .unwrap();
 
@@ -1031,6 +1551,7 @@ mod tests {
                 &GameCache::default(),
                 &path,
                 LoadScope::WholePlugin,
+                ReadMode::Buffered,
             )
             .unwrap();
 
@@ -1040,6 +1561,7 @@ mod tests {
                     &GameCache::default(),
                     &source_plugins_path(game_type).join(BLANK_FULL_ESM),
                     LoadScope::WholePlugin,
+                    ReadMode::Buffered,
                 )
                 .unwrap();
 
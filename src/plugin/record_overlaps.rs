@@ -0,0 +1,106 @@
+use std::{
+    collections::HashSet,
+    sync::{RwLock, RwLockReadGuard, RwLockWriteGuard},
+};
+
+use rustc_hash::FxHashMap as HashMap;
+
+/// The maximum number of other plugins that a plugin caches record overlap
+/// results for. Caching a result for every pair of loaded plugins would take
+/// memory quadratic in the number of plugins, so once this many results are
+/// cached, further results are not. This keeps each cache to roughly 20 KiB.
+const MAX_CACHED_RESULTS: usize = 512;
+
+/// The results of checking whether a plugin's records overlap with those of
+/// other plugins, keyed by the other plugins' IDs.
+#[derive(Debug, Default)]
+pub(super) struct RecordOverlapCache(RwLock<HashMap<u64, bool>>);
+
+impl RecordOverlapCache {
+    pub(super) fn get(&self, other_plugin_id: u64) -> Option<bool> {
+        self.read().get(&other_plugin_id).copied()
+    }
+
+    pub(super) fn insert(&self, other_plugin_id: u64, overlap: bool) {
+        let mut results = self.write();
+        if results.len() < MAX_CACHED_RESULTS {
+            results.insert(other_plugin_id, overlap);
+        }
+    }
+
+    /// Forget the results for plugins that don't have one of the given IDs.
+    pub(super) fn retain(&self, plugin_ids: &HashSet<u64>) {
+        self.write().retain(|id, _| plugin_ids.contains(id));
+    }
+
+    pub(super) fn clear(&mut self) {
+        match self.0.get_mut() {
+            Ok(results) => results.clear(),
+            Err(e) => {
+                e.into_inner().clear();
+                self.0.clear_poison();
+            }
+        }
+    }
+
+    fn read(&self) -> RwLockReadGuard<'_, HashMap<u64, bool>> {
+        match self.0.read() {
+            Ok(results) => results,
+            Err(e) => {
+                self.0.clear_poison();
+                e.into_inner()
+            }
+        }
+    }
+
+    fn write(&self) -> RwLockWriteGuard<'_, HashMap<u64, bool>> {
+        match self.0.write() {
+            Ok(results) => results,
+            Err(e) => {
+                self.0.clear_poison();
+                e.into_inner()
+            }
+        }
+    }
+}
+
+impl Clone for RecordOverlapCache {
+    fn clone(&self) -> Self {
+        Self(RwLock::new(self.read().clone()))
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn insert_should_not_cache_more_than_the_maximum_number_of_results() {
+        let cache = RecordOverlapCache::default();
+        let max = u64::try_from(MAX_CACHED_RESULTS).unwrap();
+
+        for id in 0..=max {
+            cache.insert(id, true);
+        }
+
+        assert_eq!(Some(true), cache.get(0));
+        assert_eq!(Some(true), cache.get(max - 1));
+        assert!(cache.get(max).is_none());
+    }
+
+    #[test]
+    fn retain_should_make_room_for_new_results() {
+        let cache = RecordOverlapCache::default();
+        let max = u64::try_from(MAX_CACHED_RESULTS).unwrap();
+
+        for id in 0..max {
+            cache.insert(id, true);
+        }
+        cache.retain(&HashSet::from([0]));
+        cache.insert(max, false);
+
+        assert_eq!(Some(true), cache.get(0));
+        assert!(cache.get(1).is_none());
+        assert_eq!(Some(false), cache.get(max));
+    }
+}
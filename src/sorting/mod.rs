@@ -1,5 +1,6 @@
 pub(crate) mod error;
 pub(crate) mod groups;
+mod paths_cache;
 pub(crate) mod plugins;
 mod search;
 mod validate;
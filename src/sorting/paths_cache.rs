@@ -0,0 +1,102 @@
+use petgraph::graph::NodeIndex;
+
+/// Records which nodes in a graph are known to have paths to which other nodes.
+///
+/// Each source node has a row of bits that is indexed by target node index, so
+/// checking if a path is cached is a single bit test. Rows are allocated and
+/// grown only as paths are added, so nodes with few known paths (or only paths
+/// to nodes with low indices) take up little memory.
+#[derive(Clone, Debug, Default, Eq, PartialEq)]
+pub(super) struct PathsCache {
+    rows: Vec<Vec<u64>>,
+}
+
+impl PathsCache {
+    pub(super) fn insert(&mut self, from: NodeIndex, to: NodeIndex) {
+        let (word_index, mask) = word_index_and_mask(to);
+
+        if self.rows.len() <= from.index() {
+            self.rows.resize_with(from.index() + 1, Vec::new);
+        }
+
+        if let Some(row) = self.rows.get_mut(from.index()) {
+            if row.len() <= word_index {
+                row.resize(word_index + 1, 0);
+            }
+
+            if let Some(word) = row.get_mut(word_index) {
+                *word |= mask;
+            }
+        }
+    }
+
+    pub(super) fn contains(&self, from: NodeIndex, to: NodeIndex) -> bool {
+        let (word_index, mask) = word_index_and_mask(to);
+
+        self.rows
+            .get(from.index())
+            .and_then(|row| row.get(word_index))
+            .is_some_and(|word| word & mask != 0)
+    }
+}
+
+fn word_index_and_mask(node_index: NodeIndex) -> (usize, u64) {
+    const WORD_BITS_LOG2: u32 = u64::BITS.trailing_zeros();
+    const BIT_INDEX_MASK: usize = (1 << WORD_BITS_LOG2) - 1;
+
+    let index = node_index.index();
+
+    (index >> WORD_BITS_LOG2, 1 << (index & BIT_INDEX_MASK))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn contains_should_be_false_for_an_empty_cache() {
+        let cache = PathsCache::default();
+
+        assert!(!cache.contains(NodeIndex::new(0), NodeIndex::new(0)));
+        assert!(!cache.contains(NodeIndex::new(0), NodeIndex::new(1)));
+        assert!(!cache.contains(NodeIndex::new(100), NodeIndex::new(200)));
+    }
+
+    #[test]
+    fn contains_should_be_true_only_for_inserted_paths() {
+        let mut cache = PathsCache::default();
+
+        cache.insert(NodeIndex::new(1), NodeIndex::new(2));
+
+        assert!(cache.contains(NodeIndex::new(1), NodeIndex::new(2)));
+        assert!(!cache.contains(NodeIndex::new(2), NodeIndex::new(1)));
+        assert!(!cache.contains(NodeIndex::new(0), NodeIndex::new(2)));
+        assert!(!cache.contains(NodeIndex::new(1), NodeIndex::new(3)));
+    }
+
+    #[test]
+    fn insert_should_support_node_indices_across_multiple_words() {
+        let mut cache = PathsCache::default();
+
+        let indices = [0, 1, 63, 64, 65, 127, 128, 1000];
+        for from in indices {
+            for to in indices {
+                if from != to {
+                    cache.insert(NodeIndex::new(from), NodeIndex::new(to));
+                }
+            }
+        }
+
+        for from in indices {
+            for to in indices {
+                assert_eq!(
+                    from != to,
+                    cache.contains(NodeIndex::new(from), NodeIndex::new(to))
+                );
+            }
+            assert!(!cache.contains(NodeIndex::new(from), NodeIndex::new(2)));
+            assert!(!cache.contains(NodeIndex::new(from), NodeIndex::new(999)));
+            assert!(!cache.contains(NodeIndex::new(from), NodeIndex::new(1001)));
+        }
+    }
+}
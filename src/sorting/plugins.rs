@@ -5,7 +5,9 @@ use petgraph::{
     graph::{EdgeReference, NodeIndex},
     visit::EdgeRef,
 };
+use rayon::iter::{IndexedParallelIterator, IntoParallelRefIterator, ParallelIterator};
 use rustc_hash::{FxHashMap as HashMap, FxHashSet as HashSet};
+use unicase::UniCase;
 
 use crate::{
     EdgeType, LogLevel, Plugin,
@@ -20,6 +22,7 @@ use crate::{
 
 use super::{
     groups::GroupsGraph,
+    paths_cache::PathsCache,
     search::{BidirBfsVisitor, DfsVisitor, bidirectional_bfs, depth_first_search, find_cycle},
     validate::{validate_plugin_groups, validate_specific_and_hardcoded_edges},
 };
@@ -75,7 +78,7 @@ impl<'a, T: SortingPlugin> PluginSortingData<'a, T> {
         })
     }
 
-    pub(super) fn name(&self) -> &str {
+    pub(super) fn name(&self) -> &'a str {
         self.plugin.name()
     }
 
@@ -152,7 +155,8 @@ type InnerPluginsGraph<'a, T> = Graph<Rc<PluginSortingData<'a, T>>, EdgeType>;
 #[derive(Debug)]
 struct PluginsGraph<'a, T: SortingPlugin> {
     inner: InnerPluginsGraph<'a, T>,
-    paths_cache: HashMap<NodeIndex, HashSet<NodeIndex>>,
+    paths_cache: PathsCache,
+    node_indices_by_name: HashMap<UniCase<&'a str>, NodeIndex>,
 }
 
 impl<'a, T: SortingPlugin> PluginsGraph<'a, T> {
@@ -161,7 +165,16 @@ impl<'a, T: SortingPlugin> PluginsGraph<'a, T> {
     }
 
     fn add_node(&mut self, plugin: PluginSortingData<'a, T>) -> NodeIndex {
-        self.inner.add_node(Rc::new(plugin))
+        let name = plugin.name();
+        let node_index = self.inner.add_node(Rc::new(plugin));
+
+        // Only the first node with a given name is indexed, to match what a
+        // linear search of the nodes would find.
+        self.node_indices_by_name
+            .entry(UniCase::new(name))
+            .or_insert(node_index);
+
+        node_index
     }
 
     fn add_edge(&mut self, from: NodeIndex, to: NodeIndex, edge_type: EdgeType) {
@@ -256,24 +269,21 @@ impl<'a, T: SortingPlugin> PluginsGraph<'a, T> {
             return;
         }
 
+        // Early loaders are iterated over in order, so the resulting indices
+        // are in the same order as their plugins are in early_loading_plugins.
         let mut early_loader_indices = Vec::new();
-        let mut other_plugin_indices = Vec::new();
-        for node_index in self.node_indices() {
-            let plugin = &self[node_index];
-            if let Some(i) = early_loading_plugins
-                .iter()
-                .position(|e| unicase::eq(e.as_str(), plugin.name()))
-            {
-                early_loader_indices.push((i, node_index));
-            } else {
-                other_plugin_indices.push(node_index);
+        let mut early_loader_indices_set = HashSet::default();
+        for node_index in early_loading_plugins
+            .iter()
+            .filter_map(|e| self.node_index_by_name(e))
+        {
+            if early_loader_indices_set.insert(node_index) {
+                early_loader_indices.push(node_index);
             }
         }
 
-        early_loader_indices.sort_by_key(|e| e.0);
-
         for window in early_loader_indices.windows(2) {
-            if let [(_, from_index), (_, to_index)] = *window {
+            if let [from_index, to_index] = *window {
                 self.add_edge(from_index, to_index, EdgeType::Hardcoded);
             } else {
                 // LIMITATION: This should be impossible, the windows are of
@@ -285,9 +295,11 @@ impl<'a, T: SortingPlugin> PluginsGraph<'a, T> {
             }
         }
 
-        if let Some((_, from_index)) = early_loader_indices.last() {
-            for to_index in other_plugin_indices {
-                self.add_edge(*from_index, to_index, EdgeType::Hardcoded);
+        if let Some(from_index) = early_loader_indices.last() {
+            for to_index in self.node_indices() {
+                if !early_loader_indices_set.contains(&to_index) {
+                    self.add_edge(*from_index, to_index, EdgeType::Hardcoded);
+                }
             }
         }
     }
@@ -361,95 +373,27 @@ impl<'a, T: SortingPlugin> PluginsGraph<'a, T> {
         Ok(())
     }
 
-    fn add_overlap_edges(&mut self) -> Result<(), SortingError> {
+    fn add_overlap_edges(&mut self) -> Result<(), SortingError>
+    where
+        T: Sync,
+    {
         logging::trace!("Adding edges for overlapping plugins...");
 
-        let mut node_index_iter = self.node_indices();
-        while let Some(node_index) = node_index_iter.next() {
-            let plugin = Rc::clone(&self[node_index]);
-            let plugin_asset_count = plugin.asset_count();
-
-            if plugin.override_record_count == 0 && plugin_asset_count == 0 {
-                logging::debug!(
-                    "Skipping vertex for \"{}\": the plugin contains no override records and loads no assets",
-                    plugin.name()
-                );
-                continue;
-            }
-
-            // This loop should have no effect now that master-flagged and
-            // non-master-flagged plugins are sorted separately, but is kept
-            // as a safety net.
-            for other_node_index in node_index_iter.clone() {
-                let other_plugin = &self[other_node_index];
-
-                // Don't add an edge between these two plugins if one already
-                // exists (only check direct edges and not paths for efficiency).
-                if self.inner.contains_edge(node_index, other_node_index)
-                    || self.inner.contains_edge(other_node_index, node_index)
-                {
-                    continue;
-                }
-
-                // Two plugins can overlap due to overriding the same records,
-                // or by loading assets from BSAs/BA2s that have the same path.
-                // If records overlap, the plugin that overrides more records
-                // should load earlier.
-                // If assets overlap, the plugin that loads more assets should
-                // load earlier.
-                // If two plugins have overlapping records and assets and one
-                // overrides more records but loads fewer assets than the other,
-                // the fact it overrides more records should take precedence
-                // (records are more significant than assets).
-                // I.e. if two plugins don't have overlapping records, check their
-                // assets, otherwise only check their assets if their override
-                // record counts are equal.
-
-                let outer_plugin_loads_first;
-                let edge_type;
-
-                if plugin.override_record_count == other_plugin.override_record_count
-                    || !plugin.do_records_overlap(other_plugin)?
-                {
-                    // Records don't overlap, or override the same number of records,
-                    // check assets.
-                    // No records overlap, check assets.
-                    let other_plugin_asset_count = other_plugin.asset_count();
-                    if plugin_asset_count == other_plugin_asset_count
-                        || !plugin.do_assets_overlap(other_plugin)
-                    {
-                        // Assets don't overlap or both plugins load the same number of
-                        // assets, don't add an edge.
-                        continue;
-                    }
-
-                    outer_plugin_loads_first = plugin_asset_count > other_plugin_asset_count;
-                    edge_type = EdgeType::AssetOverlap;
-                } else {
-                    // Records overlap and override different numbers of records.
-                    // Load this plugin first if it overrides more records.
-                    outer_plugin_loads_first =
-                        plugin.override_record_count > other_plugin.override_record_count;
-                    edge_type = EdgeType::RecordOverlap;
-                }
-
-                let (from_index, to_index) = if outer_plugin_loads_first {
-                    (node_index, other_node_index)
+        // Checking for overlaps is relatively slow but doesn't depend on the
+        // edges that get added here, so find all the overlaps first and then
+        // add edges for them in the same order as they would have been found
+        // sequentially.
+        for (from_index, to_index, edge_type) in self.find_overlaps()? {
+            if !self.is_path_cached(from_index, to_index) {
+                if self.path_exists(to_index, from_index) {
+                    logging::debug!(
+                        "Skipping {} edge from \"{}\" to \"{}\" as it would create a cycle.",
+                        edge_type,
+                        self[from_index].name(),
+                        self[to_index].name()
+                    );
                 } else {
-                    (other_node_index, node_index)
-                };
-
-                if !self.is_path_cached(from_index, to_index) {
-                    if self.path_exists(to_index, from_index) {
-                        logging::debug!(
-                            "Skipping {} edge from \"{}\" to \"{}\" as it would create a cycle.",
-                            edge_type,
-                            self[from_index].name(),
-                            self[to_index].name()
-                        );
-                    } else {
-                        self.add_edge(from_index, to_index, edge_type);
-                    }
+                    self.add_edge(from_index, to_index, edge_type);
                 }
             }
         }
@@ -457,6 +401,45 @@ impl<'a, T: SortingPlugin> PluginsGraph<'a, T> {
         Ok(())
     }
 
+    /// Returns the edges that should be added between overlapping plugins,
+    /// ordered by their outer and then inner node index.
+    fn find_overlaps(&self) -> Result<Vec<(NodeIndex, NodeIndex, EdgeType)>, PluginDataError>
+    where
+        T: Sync,
+    {
+        // The graph's node weights are Rcs, so can't be shared between
+        // threads, but the data they point to can be.
+        let plugins: Vec<_> = self
+            .node_indices()
+            .map(|node_index| (node_index, &*self[node_index]))
+            .collect();
+
+        // Don't add an edge between two plugins if one already exists (only
+        // check direct edges and not paths for efficiency).
+        let linked_plugins: HashSet<_> = self
+            .inner
+            .edge_references()
+            .map(|edge| (edge.source(), edge.target()))
+            .collect();
+
+        let overlaps: Vec<_> = plugins
+            .par_iter()
+            .enumerate()
+            .map(|(i, &(node_index, plugin))| {
+                let other_plugins = plugins.get(i + 1..).unwrap_or_default();
+                find_plugin_overlaps(node_index, plugin, other_plugins, &linked_plugins)
+            })
+            .collect();
+
+        // Collect sequentially so that the first error is returned.
+        let mut all_overlaps = Vec::new();
+        for plugin_overlaps in overlaps {
+            all_overlaps.extend(plugin_overlaps?);
+        }
+
+        Ok(all_overlaps)
+    }
+
     fn add_tie_break_edges(&mut self) -> Result<(), PathfindingError> {
         logging::trace!("Adding edges to break ties between plugins...");
 
@@ -507,8 +490,7 @@ impl<'a, T: SortingPlugin> PluginsGraph<'a, T> {
         let mut processed_nodes = HashSet::default();
 
         // First get the graph vertices and sort them into the current load order.
-        let mut nodes: Vec<_> = self.node_indices().collect();
-        nodes.sort_by_key(|a| self[*a].load_order_index);
+        let nodes = self.nodes_in_load_order();
 
         for window in nodes.windows(2) {
             let [current, next] = *window else {
@@ -699,6 +681,22 @@ impl<'a, T: SortingPlugin> PluginsGraph<'a, T> {
         insert_position + 1
     }
 
+    fn nodes_in_load_order(&self) -> Vec<NodeIndex> {
+        let mut nodes: Vec<_> = self.node_indices().collect();
+        nodes.sort_by_key(|a| self[*a].load_order_index);
+        nodes
+    }
+
+    /// Check if the current load order already satisfies every edge in the
+    /// graph. If it does, adding tie-break edges would just link each pair of
+    /// consecutive plugins in the current load order, so it's also the sorted
+    /// load order.
+    fn is_current_load_order_sorted(&self) -> bool {
+        self.inner
+            .edge_references()
+            .all(|e| self[e.source()].load_order_index < self[e.target()].load_order_index)
+    }
+
     fn topological_sort(&self) -> Result<Vec<NodeIndex>, SortingError> {
         petgraph::algo::toposort(&self.inner, None)
             .map_err(|e| SortingError::CycleInvolving(self[e.node_id()].name().to_owned()))
@@ -724,16 +722,15 @@ impl<'a, T: SortingPlugin> PluginsGraph<'a, T> {
     }
 
     fn cache_path(&mut self, from: NodeIndex, to: NodeIndex) {
-        self.paths_cache.entry(from).or_default().insert(to);
+        self.paths_cache.insert(from, to);
     }
 
     fn is_path_cached(&self, from: NodeIndex, to: NodeIndex) -> bool {
-        self.paths_cache.get(&from).is_some_and(|s| s.contains(&to))
+        self.paths_cache.contains(from, to)
     }
 
     fn node_index_by_name(&self, name: &str) -> Option<NodeIndex> {
-        self.node_indices()
-            .find(|i| unicase::eq(self[*i].name(), name))
+        self.node_indices_by_name.get(&UniCase::new(name)).copied()
     }
 
     fn path_exists(&mut self, from: NodeIndex, to: NodeIndex) -> bool {
@@ -766,7 +763,8 @@ impl<T: SortingPlugin> std::default::Default for PluginsGraph<'_, T> {
     fn default() -> Self {
         Self {
             inner: Graph::default(),
-            paths_cache: HashMap::default(),
+            paths_cache: PathsCache::default(),
+            node_indices_by_name: HashMap::default(),
         }
     }
 }
@@ -779,7 +777,7 @@ impl<'a, T: SortingPlugin> std::ops::Index<NodeIndex> for PluginsGraph<'a, T> {
     }
 }
 
-pub(crate) fn sort_plugins<T: SortingPlugin>(
+pub(crate) fn sort_plugins<T: SortingPlugin + Sync>(
     mut plugins_sorting_data: Vec<PluginSortingData<T>>,
     groups_graph: &GroupsGraph,
     early_loading_plugins: &[String],
@@ -823,14 +821,22 @@ pub(crate) fn sort_plugins<T: SortingPlugin>(
         early_loading_plugins,
     )?;
 
-    let mut masters_load_order =
-        sort_plugins_partition(masters, groups_graph, early_loading_plugins)?;
-
-    let blueprint_masters_load_order =
-        sort_plugins_partition(blueprint_masters, groups_graph, early_loading_plugins)?;
+    // The three partitions share no state, so they can be sorted in parallel.
+    // Their results are checked in a fixed order so that if more than one
+    // partition fails to sort, the error that's returned is deterministic.
+    let (masters_result, (blueprint_masters_result, non_masters_result)) = rayon::join(
+        || sort_plugins_partition(masters, groups_graph, early_loading_plugins),
+        || {
+            rayon::join(
+                || sort_plugins_partition(blueprint_masters, groups_graph, early_loading_plugins),
+                || sort_plugins_partition(non_masters, groups_graph, early_loading_plugins),
+            )
+        },
+    );
 
-    let non_masters_load_order =
-        sort_plugins_partition(non_masters, groups_graph, early_loading_plugins)?;
+    let mut masters_load_order = masters_result?;
+    let blueprint_masters_load_order = blueprint_masters_result?;
+    let non_masters_load_order = non_masters_result?;
 
     masters_load_order.extend(non_masters_load_order);
     masters_load_order.extend(blueprint_masters_load_order);
@@ -838,7 +844,7 @@ pub(crate) fn sort_plugins<T: SortingPlugin>(
     Ok(masters_load_order)
 }
 
-fn sort_plugins_partition<T: SortingPlugin>(
+fn sort_plugins_partition<T: SortingPlugin + Sync>(
     plugins_sorting_data: Vec<PluginSortingData<T>>,
     groups_graph: &GroupsGraph,
     early_loading_plugins: &[String],
@@ -860,6 +866,21 @@ fn sort_plugins_partition<T: SortingPlugin>(
 
     graph.add_group_edges(groups_graph)?;
     graph.add_overlap_edges()?;
+
+    if graph.is_current_load_order_sorted() {
+        logging::debug!(
+            "The current load order satisfies all sorting constraints, so it is unchanged"
+        );
+
+        let sorted_plugin_names = graph
+            .nodes_in_load_order()
+            .into_iter()
+            .map(|i| graph[i].name().to_owned())
+            .collect();
+
+        return Ok(sorted_plugin_names);
+    }
+
     graph.add_tie_break_edges()?;
 
     // Check for cycles again, just in case there's a bug that lets some occur.
@@ -884,6 +905,86 @@ fn sort_plugins_partition<T: SortingPlugin>(
     Ok(sorted_plugin_names)
 }
 
+fn find_plugin_overlaps<T: SortingPlugin>(
+    node_index: NodeIndex,
+    plugin: &PluginSortingData<T>,
+    other_plugins: &[(NodeIndex, &PluginSortingData<T>)],
+    linked_plugins: &HashSet<(NodeIndex, NodeIndex)>,
+) -> Result<Vec<(NodeIndex, NodeIndex, EdgeType)>, PluginDataError> {
+    let mut overlaps = Vec::new();
+
+    let plugin_asset_count = plugin.asset_count();
+
+    if plugin.override_record_count == 0 && plugin_asset_count == 0 {
+        logging::debug!(
+            "Skipping vertex for \"{}\": the plugin contains no override records and loads no assets",
+            plugin.name()
+        );
+        return Ok(overlaps);
+    }
+
+    // This loop should have no effect now that master-flagged and
+    // non-master-flagged plugins are sorted separately, but is kept
+    // as a safety net.
+    for &(other_node_index, other_plugin) in other_plugins {
+        if linked_plugins.contains(&(node_index, other_node_index))
+            || linked_plugins.contains(&(other_node_index, node_index))
+        {
+            continue;
+        }
+
+        // Two plugins can overlap due to overriding the same records,
+        // or by loading assets from BSAs/BA2s that have the same path.
+        // If records overlap, the plugin that overrides more records
+        // should load earlier.
+        // If assets overlap, the plugin that loads more assets should
+        // load earlier.
+        // If two plugins have overlapping records and assets and one
+        // overrides more records but loads fewer assets than the other,
+        // the fact it overrides more records should take precedence
+        // (records are more significant than assets).
+        // I.e. if two plugins don't have overlapping records, check their
+        // assets, otherwise only check their assets if their override
+        // record counts are equal.
+
+        let outer_plugin_loads_first;
+        let edge_type;
+
+        if plugin.override_record_count == other_plugin.override_record_count
+            || !plugin.do_records_overlap(other_plugin)?
+        {
+            // Records don't overlap, or override the same number of records,
+            // check assets.
+            // No records overlap, check assets.
+            let other_plugin_asset_count = other_plugin.asset_count();
+            if plugin_asset_count == other_plugin_asset_count
+                || !plugin.do_assets_overlap(other_plugin)
+            {
+                // Assets don't overlap or both plugins load the same number of
+                // assets, don't add an edge.
+                continue;
+            }
+
+            outer_plugin_loads_first = plugin_asset_count > other_plugin_asset_count;
+            edge_type = EdgeType::AssetOverlap;
+        } else {
+            // Records overlap and override different numbers of records.
+            // Load this plugin first if it overrides more records.
+            outer_plugin_loads_first =
+                plugin.override_record_count > other_plugin.override_record_count;
+            edge_type = EdgeType::RecordOverlap;
+        }
+
+        if outer_plugin_loads_first {
+            overlaps.push((node_index, other_node_index, edge_type));
+        } else {
+            overlaps.push((other_node_index, node_index, edge_type));
+        }
+    }
+
+    Ok(overlaps)
+}
+
 fn path_to_string<T: SortingPlugin>(graph: &InnerPluginsGraph<T>, path: &[NodeIndex]) -> String {
     path.iter()
         .map(|i| graph[*i].name())
@@ -894,7 +995,7 @@ fn path_to_string<T: SortingPlugin>(graph: &InnerPluginsGraph<T>, path: &[NodeIn
 #[derive(Debug)]
 struct PathFinder<'a, 'b, T: SortingPlugin> {
     graph: &'a InnerPluginsGraph<'b, T>,
-    cache: &'a mut HashMap<NodeIndex, HashSet<NodeIndex>>,
+    cache: &'a mut PathsCache,
     from_node_index: NodeIndex,
     to_node_index: NodeIndex,
     forward_parents: HashMap<NodeIndex, NodeIndex>,
@@ -905,7 +1006,7 @@ struct PathFinder<'a, 'b, T: SortingPlugin> {
 impl<'a, 'b, T: SortingPlugin> PathFinder<'a, 'b, T> {
     fn new(
         graph: &'a InnerPluginsGraph<'b, T>,
-        cache: &'a mut HashMap<NodeIndex, HashSet<NodeIndex>>,
+        cache: &'a mut PathsCache,
         from_node_index: NodeIndex,
         to_node_index: NodeIndex,
     ) -> Self {
@@ -921,7 +1022,7 @@ impl<'a, 'b, T: SortingPlugin> PathFinder<'a, 'b, T> {
     }
 
     fn cache_path(&mut self, from: NodeIndex, to: NodeIndex) {
-        self.cache.entry(from).or_default().insert(to);
+        self.cache.insert(from, to);
     }
 
     fn path(&self) -> Result<Option<Vec<NodeIndex>>, PathfindingError> {
@@ -998,7 +1099,7 @@ impl<T: SortingPlugin> BidirBfsVisitor for PathFinder<'_, '_, T> {
 
 #[derive(Debug)]
 struct PathCacher<'a> {
-    cache: &'a mut HashMap<NodeIndex, HashSet<NodeIndex>>,
+    cache: &'a mut PathsCache,
     from_node_index: NodeIndex,
     to_node_index: NodeIndex,
 }
@@ -1034,7 +1135,7 @@ fn get_plugins_in_groups<T: SortingPlugin>(
 
 impl<'a> PathCacher<'a> {
     fn new(
-        cache: &'a mut HashMap<NodeIndex, HashSet<NodeIndex>>,
+        cache: &'a mut PathsCache,
         from_node_index: NodeIndex,
         to_node_index: NodeIndex,
     ) -> Self {
@@ -1046,7 +1147,7 @@ impl<'a> PathCacher<'a> {
     }
 
     fn cache_path(&mut self, from: NodeIndex, to: NodeIndex) {
-        self.cache.entry(from).or_default().insert(to);
+        self.cache.insert(from, to);
     }
 }
 
@@ -1440,6 +1541,49 @@ mod tests {
             assert!(sorted.is_empty());
         }
 
+        mod node_index_by_name {
+            use super::*;
+
+            #[test]
+            fn should_match_plugin_names_case_insensitively() {
+                let fixture = Fixture::with_plugins(&[PLUGIN_A, PLUGIN_B]);
+
+                let mut graph = PluginsGraph::<TestPlugin>::new();
+                let a = graph.add_node(fixture.sorting_data(PLUGIN_A));
+                let b = graph.add_node(fixture.sorting_data(PLUGIN_B));
+
+                assert_eq!(Some(a), graph.node_index_by_name("a.ESP"));
+                assert_eq!(Some(b), graph.node_index_by_name(PLUGIN_B));
+                assert_eq!(None, graph.node_index_by_name(PLUGIN_C));
+            }
+        }
+
+        mod add_specific_edges {
+            use super::*;
+
+            #[test]
+            fn should_add_edges_for_masters_and_metadata_that_differ_only_in_case() {
+                let mut fixture = Fixture::with_plugins(&[PLUGIN_A, PLUGIN_B, PLUGIN_C, PLUGIN_D]);
+                fixture.get_plugin_mut(PLUGIN_D).add_master("a.esp");
+
+                let mut graph = PluginsGraph::<TestPlugin>::new();
+                let a = graph.add_node(fixture.sorting_data(PLUGIN_A));
+                let b = graph.add_node(fixture.sorting_data(PLUGIN_B));
+                let c = graph.add_node(fixture.sorting_data(PLUGIN_C));
+                let mut d = fixture.sorting_data(PLUGIN_D);
+                d.masterlist_load_after = Box::new(["b.ESP".into()]);
+                d.user_req = Box::new(["c.Esp".into(), "missing.esp".into()]);
+                let d = graph.add_node(d);
+
+                graph.add_specific_edges().unwrap();
+
+                assert_eq!(EdgeType::Master, edge_type(&graph, a, d));
+                assert_eq!(EdgeType::MasterlistLoadAfter, edge_type(&graph, b, d));
+                assert_eq!(EdgeType::UserRequirement, edge_type(&graph, c, d));
+                assert_eq!(3, graph.inner.edge_count());
+            }
+        }
+
         mod add_early_loading_plugin_edges {
             use super::*;
 
@@ -1510,6 +1654,30 @@ mod tests {
 
                 assert!(graph.check_for_cycles().is_ok());
             }
+
+            #[test]
+            fn should_match_early_loaders_case_insensitively_and_ignore_duplicates() {
+                let fixture = Fixture::with_plugins(&[PLUGIN_A, PLUGIN_B, PLUGIN_C]);
+
+                let mut graph = PluginsGraph::<TestPlugin>::new();
+                let a = graph.add_node(fixture.sorting_data(PLUGIN_A));
+                let b = graph.add_node(fixture.sorting_data(PLUGIN_B));
+                let c = graph.add_node(fixture.sorting_data(PLUGIN_C));
+
+                graph.add_early_loading_plugin_edges(&[
+                    "b.esp".into(),
+                    "A.ESP".into(),
+                    PLUGIN_B.into(),
+                ]);
+
+                assert_eq!(EdgeType::Hardcoded, edge_type(&graph, b, a));
+                assert_eq!(EdgeType::Hardcoded, edge_type(&graph, a, c));
+                assert!(!graph.inner.contains_edge(a, b));
+                assert!(!graph.inner.contains_edge(b, b));
+                assert_eq!(2, graph.inner.edge_count());
+
+                assert!(graph.check_for_cycles().is_ok());
+            }
         }
 
         mod add_group_edges {
@@ -3091,6 +3259,92 @@ mod tests {
                 assert_eq!(EdgeType::RecordOverlap, edge_type(&graph, a, b));
                 assert!(!graph.inner.contains_edge(b, a));
             }
+
+            #[test]
+            fn should_not_add_edge_between_plugins_that_already_have_an_edge_between_them() {
+                let mut fixture = Fixture::with_plugins(&[PLUGIN_A, PLUGIN_B]);
+
+                let a = fixture.get_plugin_mut(PLUGIN_A);
+                a.override_record_count = 2;
+                a.add_overlapping_records(PLUGIN_B);
+
+                let b = fixture.get_plugin_mut(PLUGIN_B);
+                b.override_record_count = 1;
+
+                let mut graph = PluginsGraph::<TestPlugin>::new();
+                let a = graph.add_node(fixture.sorting_data(PLUGIN_A));
+                let b = graph.add_node(fixture.sorting_data(PLUGIN_B));
+                graph.add_edge(b, a, EdgeType::Master);
+
+                graph.add_overlap_edges().unwrap();
+
+                assert!(!graph.inner.contains_edge(a, b));
+                assert_eq!(1, graph.inner.edge_count());
+            }
+
+            #[test]
+            fn should_add_edges_in_node_order_and_skip_edges_that_would_cause_a_cycle() {
+                let mut fixture = Fixture::with_plugins(&[PLUGIN_A, PLUGIN_B, PLUGIN_C]);
+
+                let a = fixture.get_plugin_mut(PLUGIN_A);
+                a.override_record_count = 3;
+                a.add_overlapping_records(PLUGIN_B);
+
+                let b = fixture.get_plugin_mut(PLUGIN_B);
+                b.override_record_count = 2;
+                b.add_overlapping_records(PLUGIN_C);
+
+                let c = fixture.get_plugin_mut(PLUGIN_C);
+                c.override_record_count = 1;
+
+                let mut graph = PluginsGraph::<TestPlugin>::new();
+                let a = graph.add_node(fixture.sorting_data(PLUGIN_A));
+                let b = graph.add_node(fixture.sorting_data(PLUGIN_B));
+                let c = graph.add_node(fixture.sorting_data(PLUGIN_C));
+                graph.add_edge(c, a, EdgeType::Master);
+
+                graph.add_overlap_edges().unwrap();
+
+                assert_eq!(EdgeType::RecordOverlap, edge_type(&graph, a, b));
+                assert!(!graph.inner.contains_edge(b, c));
+                assert!(graph.check_for_cycles().is_ok());
+            }
+        }
+
+        mod is_current_load_order_sorted {
+            use super::*;
+
+            #[test]
+            fn should_be_true_if_every_edge_goes_forwards_in_the_load_order() {
+                let fixture = Fixture::with_plugins(&[PLUGIN_A, PLUGIN_B, PLUGIN_C]);
+
+                let mut graph = PluginsGraph::<TestPlugin>::new();
+                let a = graph.add_node(fixture.sorting_data(PLUGIN_A));
+                let b = graph.add_node(fixture.sorting_data(PLUGIN_B));
+                let c = graph.add_node(fixture.sorting_data(PLUGIN_C));
+
+                assert!(graph.is_current_load_order_sorted());
+
+                graph.add_edge(a, c, EdgeType::Master);
+                graph.add_edge(b, c, EdgeType::MasterlistGroup);
+
+                assert!(graph.is_current_load_order_sorted());
+            }
+
+            #[test]
+            fn should_be_false_if_any_edge_goes_backwards_in_the_load_order() {
+                let fixture = Fixture::with_plugins(&[PLUGIN_A, PLUGIN_B, PLUGIN_C]);
+
+                let mut graph = PluginsGraph::<TestPlugin>::new();
+                let a = graph.add_node(fixture.sorting_data(PLUGIN_A));
+                let b = graph.add_node(fixture.sorting_data(PLUGIN_B));
+                let c = graph.add_node(fixture.sorting_data(PLUGIN_C));
+
+                graph.add_edge(a, b, EdgeType::Master);
+                graph.add_edge(c, b, EdgeType::MasterlistGroup);
+
+                assert!(!graph.is_current_load_order_sorted());
+            }
         }
 
         mod add_tie_break_edges {
@@ -3273,6 +3527,124 @@ mod tests {
             assert_eq!(expected, sorted.as_slice());
         }
 
+        #[test]
+        fn should_return_the_current_load_order_if_it_already_satisfies_all_edges() {
+            const PLUGIN_C: &str = "C.esp";
+
+            let mut fixture = Fixture::with_plugins(&[PLUGIN_A, PLUGIN_B, PLUGIN_C]);
+            fixture.get_plugin_mut(PLUGIN_C).add_master(PLUGIN_A);
+
+            let sorted = sort_plugins(
+                vec![
+                    fixture.sorting_data(PLUGIN_C),
+                    fixture.sorting_data(PLUGIN_B),
+                    fixture.sorting_data(PLUGIN_A),
+                ],
+                &fixture.groups_graph,
+                &[],
+            )
+            .unwrap();
+
+            assert_eq!(&[PLUGIN_A, PLUGIN_B, PLUGIN_C], sorted.as_slice());
+        }
+
+        #[test]
+        fn should_add_an_early_loader_edge_to_plugins_that_already_load_after_other_plugins() {
+            const PLUGIN_C: &str = "C.esp";
+            const PLUGIN_D: &str = "D.esp";
+
+            // D already loads after the early loader A through each of its
+            // masters, but its own edge from A is what decides the tie-break
+            // between B and C.
+            let mut fixture = Fixture::with_plugins(&[PLUGIN_D, PLUGIN_A, PLUGIN_B, PLUGIN_C]);
+            fixture.get_plugin_mut(PLUGIN_B).add_master(PLUGIN_A);
+            fixture.get_plugin_mut(PLUGIN_D).add_master(PLUGIN_B);
+            fixture.get_plugin_mut(PLUGIN_D).add_master(PLUGIN_C);
+
+            let sorted = sort_plugins(
+                vec![
+                    fixture.sorting_data(PLUGIN_A),
+                    fixture.sorting_data(PLUGIN_B),
+                    fixture.sorting_data(PLUGIN_C),
+                    fixture.sorting_data(PLUGIN_D),
+                ],
+                &fixture.groups_graph,
+                &[PLUGIN_A.into()],
+            )
+            .unwrap();
+
+            assert_eq!(&[PLUGIN_A, PLUGIN_B, PLUGIN_C, PLUGIN_D], sorted.as_slice());
+        }
+
+        #[test]
+        fn should_add_group_edges_to_plugins_that_already_load_after_plugins_in_later_groups() {
+            const PLUGIN_C: &str = "C.esp";
+            const PLUGIN_D: &str = "D.esp";
+
+            // D already loads after A through the plugins in group B, but its
+            // own edge from A is what decides the tie-break between B and C.
+            let fixture = Fixture::with_plugins(&[PLUGIN_D, PLUGIN_A, PLUGIN_B, PLUGIN_C]);
+
+            let sorted = sort_plugins(
+                vec![
+                    fixture.group_sorting_data(PLUGIN_A, "A"),
+                    fixture.group_sorting_data(PLUGIN_B, "B"),
+                    fixture.group_sorting_data(PLUGIN_C, "B"),
+                    fixture.group_sorting_data(PLUGIN_D, "C"),
+                ],
+                &fixture.groups_graph,
+                &[],
+            )
+            .unwrap();
+
+            assert_eq!(&[PLUGIN_A, PLUGIN_B, PLUGIN_C, PLUGIN_D], sorted.as_slice());
+        }
+
+        #[test]
+        fn should_skip_edges_between_plugins_that_searches_have_found_paths_between() {
+            const PLUGIN_C: &str = "C.esp";
+            const PLUGIN_D: &str = "D.esp";
+            const PLUGIN_E: &str = "E.esp";
+            const PLUGIN_F: &str = "F.esp";
+
+            // Searches that don't find the path they're looking for still
+            // record the paths that they find along the way, and those decide
+            // which overlap and tie-break edges are redundant, which then
+            // decides the tie-break between A and D.
+            let mut fixture = Fixture::with_plugins(&[
+                PLUGIN_F, PLUGIN_E, PLUGIN_C, PLUGIN_B, PLUGIN_A, PLUGIN_D,
+            ]);
+            let overlapping_plugins = [PLUGIN_A, PLUGIN_B, PLUGIN_D, PLUGIN_E, PLUGIN_F];
+            for (name, override_record_count) in overlapping_plugins.iter().zip([3, 1, 3, 4, 2]) {
+                let plugin = fixture.get_plugin_mut(name);
+                plugin.override_record_count = override_record_count;
+                for other_name in overlapping_plugins {
+                    if other_name != *name {
+                        plugin.add_overlapping_records(other_name);
+                    }
+                }
+            }
+
+            let sorted = sort_plugins(
+                vec![
+                    fixture.sorting_data(PLUGIN_A),
+                    fixture.sorting_data(PLUGIN_B),
+                    fixture.group_sorting_data(PLUGIN_C, "E"),
+                    fixture.sorting_data(PLUGIN_D),
+                    fixture.sorting_data(PLUGIN_E),
+                    fixture.sorting_data(PLUGIN_F),
+                ],
+                &fixture.groups_graph,
+                &[],
+            )
+            .unwrap();
+
+            assert_eq!(
+                &[PLUGIN_E, PLUGIN_D, PLUGIN_A, PLUGIN_F, PLUGIN_B, PLUGIN_C],
+                sorted.as_slice()
+            );
+        }
+
         #[test]
         fn should_use_group_metadata_when_deciding_relative_plugin_positions() {
             let fixture = Fixture::with_plugins(&[PLUGIN_B, PLUGIN_A]);
@@ -3372,6 +3744,42 @@ mod tests {
             }
         }
 
+        #[test]
+        fn should_report_the_masters_partition_error_if_multiple_partitions_have_cycles() {
+            const PLUGIN_C: &str = "C.esm";
+            const PLUGIN_D: &str = "D.esm";
+
+            let mut fixture = Fixture::with_plugins(&[PLUGIN_A, PLUGIN_B, PLUGIN_C, PLUGIN_D]);
+
+            fixture.get_plugin_mut(PLUGIN_C).is_master = true;
+            fixture.get_plugin_mut(PLUGIN_D).is_master = true;
+
+            fixture.get_plugin_mut(PLUGIN_A).add_master(PLUGIN_B);
+            fixture.get_plugin_mut(PLUGIN_B).add_master(PLUGIN_A);
+            fixture.get_plugin_mut(PLUGIN_C).add_master(PLUGIN_D);
+            fixture.get_plugin_mut(PLUGIN_D).add_master(PLUGIN_C);
+
+            let data = vec![
+                fixture.sorting_data(PLUGIN_A),
+                fixture.sorting_data(PLUGIN_B),
+                fixture.sorting_data(PLUGIN_C),
+                fixture.sorting_data(PLUGIN_D),
+            ];
+
+            match sort_plugins(data, &fixture.groups_graph, &[]) {
+                Err(SortingError::CycleFound(e)) => {
+                    assert_eq!(
+                        &[
+                            Vertex::new(PLUGIN_C.into()).with_out_edge_type(EdgeType::Master),
+                            Vertex::new(PLUGIN_D.into()).with_out_edge_type(EdgeType::Master),
+                        ],
+                        e.into_cycle().as_slice()
+                    );
+                }
+                _ => panic!("Expected to find a cycle"),
+            }
+        }
+
         #[test]
         fn should_error_if_a_master_edge_would_contradict_master_flags() {
             let mut fixture = Fixture::with_plugins(&[PLUGIN_A, PLUGIN_B]);
@@ -3,9 +3,9 @@ use std::collections::VecDeque;
 use petgraph::{
     Graph,
     graph::{EdgeReference, NodeIndex},
-    visit::EdgeRef,
+    visit::{EdgeRef, VisitMap, Visitable},
 };
-use rustc_hash::{FxHashMap as HashMap, FxHashSet as HashSet};
+use rustc_hash::FxHashMap as HashMap;
 
 use crate::{EdgeType, Vertex, logging};
 
@@ -37,38 +37,36 @@ pub(super) fn bidirectional_bfs<N, E>(
 ) -> bool {
     let mut forward_queue = VecDeque::from([from_index]);
     let mut reverse_queue = VecDeque::from([to_index]);
-    let mut forward_visited = HashSet::default();
-    forward_visited.insert(from_index);
-    let mut reverse_visited = HashSet::default();
-    reverse_visited.insert(to_index);
+    let mut forward_visited = graph.visit_map();
+    forward_visited.visit(from_index);
+    let mut reverse_visited = graph.visit_map();
+    reverse_visited.visit(to_index);
 
     while let (Some(forward_current), Some(reverse_current)) =
         (forward_queue.pop_front(), reverse_queue.pop_front())
     {
-        if forward_current == to_index || reverse_visited.contains(&forward_current) {
+        if forward_current == to_index || reverse_visited.is_visited(&forward_current) {
             visitor.visit_intersection_node(forward_current);
             return true;
         }
 
         for adjacent in graph.neighbors(forward_current) {
-            if !forward_visited.contains(&adjacent) {
+            if forward_visited.visit(adjacent) {
                 visitor.visit_forward_bfs_edge(forward_current, adjacent);
 
-                forward_visited.insert(adjacent);
                 forward_queue.push_back(adjacent);
             }
         }
 
-        if reverse_current == from_index || forward_visited.contains(&reverse_current) {
+        if reverse_current == from_index || forward_visited.is_visited(&reverse_current) {
             visitor.visit_intersection_node(reverse_current);
             return true;
         }
 
         for adjacent in graph.neighbors_directed(reverse_current, petgraph::Direction::Incoming) {
-            if !reverse_visited.contains(&adjacent) {
+            if reverse_visited.visit(adjacent) {
                 visitor.visit_reverse_bfs_edge(adjacent, reverse_current);
 
-                reverse_visited.insert(adjacent);
                 reverse_queue.push_back(adjacent);
             }
         }